@@ -8,6 +8,7 @@
 #include <memory>
 #include <utility>
 
+#include "base/strings/stringprintf.h"
 #include "brave/browser/brave_ads/ads_service_factory.h"
 #include "chrome/browser/profiles/profile.h"
 #include "components/dom_distiller/content/browser/distiller_javascript_utils.h"
@@ -27,6 +28,14 @@
 
 namespace brave_ads {
 
+namespace {
+
+// Text classification only uses the first 1 MiB of text, so truncate the text
+// in the page rather than serializing the remainder across processes
+constexpr int kMaximumTextLength = 1 << 20;
+
+}  // namespace
+
 AdsTabHelper::AdsTabHelper(content::WebContents* web_contents)
     : WebContentsObserver(web_contents),
       content::WebContentsUserData<AdsTabHelper>(*web_contents),
@@ -66,13 +75,21 @@ void AdsTabHelper::RunIsolatedJavaScript(
     content::RenderFrameHost* render_frame_host) {
   DCHECK(render_frame_host);
 
+  if (!ads_service_ || !ads_service_->IsEnabled()) {
+    // Avoid serializing the page if ads are disabled as the content would be
+    // discarded by the ads service
+    return;
+  }
+
   dom_distiller::RunIsolatedJavaScript(
       render_frame_host, "new XMLSerializer().serializeToString(document)",
       base::BindOnce(&AdsTabHelper::OnJavaScriptHtmlResult,
                      weak_factory_.GetWeakPtr()));
 
   dom_distiller::RunIsolatedJavaScript(
-      render_frame_host, "document?.body?.innerText",
+      render_frame_host,
+      base::StringPrintf("document?.body?.innerText?.substring(0, %d)",
+                         kMaximumTextLength),
       base::BindOnce(&AdsTabHelper::OnJavaScriptTextResult,
                      weak_factory_.GetWeakPtr()));
 }
@@ -0,0 +1,142 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/decentralized_dns/resolution_cache.h"
+
+#include <string>
+#include <vector>
+
+#include "base/bind.h"
+#include "base/test/task_environment.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace decentralized_dns {
+
+namespace {
+
+constexpr char kHost[] = "brave.crypto";
+constexpr char kURLSpec[] =
+    "ipfs://QmWrdNJWMbvRxxzLhojVKaBDswS4KNVM7LvjsN7QbDrvka";
+
+}  // namespace
+
+class ResolutionCacheUnitTest : public testing::Test {
+ public:
+  ResolutionCacheUnitTest() = default;
+  ~ResolutionCacheUnitTest() override = default;
+
+  ResolutionCache::LookupResult Lookup(const std::string& host,
+                                       std::string* url_spec) {
+    return cache_.Lookup(host, url_spec,
+                         base::BindOnce(
+                             [](std::vector<std::string>* results,
+                                const std::string& url_spec) {
+                               results->push_back(url_spec);
+                             },
+                             &results_));
+  }
+
+  ResolutionCache* cache() { return &cache_; }
+  const std::vector<std::string>& results() const { return results_; }
+
+ protected:
+  base::test::TaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
+
+ private:
+  ResolutionCache cache_;
+  std::vector<std::string> results_;
+};
+
+TEST_F(ResolutionCacheUnitTest, CoalesceLookupsWhileResolving) {
+  std::string url_spec;
+  EXPECT_EQ(ResolutionCache::LookupResult::kMiss, Lookup(kHost, &url_spec));
+  EXPECT_EQ(ResolutionCache::LookupResult::kPending, Lookup(kHost, &url_spec));
+  EXPECT_TRUE(results().empty());
+
+  cache()->OnResolved(kHost, /* success */ true, kURLSpec);
+  EXPECT_EQ(std::vector<std::string>({kURLSpec, kURLSpec}), results());
+
+  EXPECT_EQ(ResolutionCache::LookupResult::kHit, Lookup(kHost, &url_spec));
+  EXPECT_EQ(kURLSpec, url_spec);
+  EXPECT_EQ(2u, results().size());
+}
+
+TEST_F(ResolutionCacheUnitTest, DoNotCacheFailedResolutions) {
+  std::string url_spec;
+  EXPECT_EQ(ResolutionCache::LookupResult::kMiss, Lookup(kHost, &url_spec));
+
+  cache()->OnResolved(kHost, /* success */ false, kURLSpec);
+  EXPECT_EQ(std::vector<std::string>({""}), results());
+  EXPECT_EQ(0u, cache()->size());
+
+  EXPECT_EQ(ResolutionCache::LookupResult::kMiss, Lookup(kHost, &url_spec));
+}
+
+TEST_F(ResolutionCacheUnitTest, NegativeEntriesExpireBeforePositiveEntries) {
+  const std::string kOtherHost = "brave.eth";
+
+  std::string url_spec;
+  EXPECT_EQ(ResolutionCache::LookupResult::kMiss, Lookup(kHost, &url_spec));
+  cache()->OnResolved(kHost, /* success */ true, kURLSpec);
+  EXPECT_EQ(ResolutionCache::LookupResult::kMiss,
+            Lookup(kOtherHost, &url_spec));
+  cache()->OnResolved(kOtherHost, /* success */ true, "");
+
+  task_environment_.FastForwardBy(base::Minutes(2));
+
+  EXPECT_EQ(ResolutionCache::LookupResult::kHit, Lookup(kHost, &url_spec));
+  EXPECT_EQ(kURLSpec, url_spec);
+
+  url_spec.clear();
+  EXPECT_EQ(ResolutionCache::LookupResult::kStaleHit,
+            Lookup(kOtherHost, &url_spec));
+  EXPECT_TRUE(url_spec.empty());
+}
+
+TEST_F(ResolutionCacheUnitTest, RevalidateStaleEntriesOnce) {
+  std::string url_spec;
+  EXPECT_EQ(ResolutionCache::LookupResult::kMiss, Lookup(kHost, &url_spec));
+  cache()->OnResolved(kHost, /* success */ true, kURLSpec);
+
+  task_environment_.FastForwardBy(base::Minutes(10));
+
+  EXPECT_EQ(ResolutionCache::LookupResult::kStaleHit,
+            Lookup(kHost, &url_spec));
+  EXPECT_EQ(kURLSpec, url_spec);
+
+  // Only one refresh is started while the stale entry is being revalidated.
+  EXPECT_EQ(ResolutionCache::LookupResult::kHit, Lookup(kHost, &url_spec));
+
+  cache()->OnResolved(kHost, /* success */ true, "https://brave.com/");
+  EXPECT_EQ(ResolutionCache::LookupResult::kHit, Lookup(kHost, &url_spec));
+  EXPECT_EQ("https://brave.com/", url_spec);
+}
+
+TEST_F(ResolutionCacheUnitTest, ResolveAgainAfterStaleWindow) {
+  std::string url_spec;
+  EXPECT_EQ(ResolutionCache::LookupResult::kMiss, Lookup(kHost, &url_spec));
+  cache()->OnResolved(kHost, /* success */ true, kURLSpec);
+
+  task_environment_.FastForwardBy(base::Hours(2));
+
+  url_spec.clear();
+  EXPECT_EQ(ResolutionCache::LookupResult::kMiss, Lookup(kHost, &url_spec));
+  EXPECT_TRUE(url_spec.empty());
+}
+
+TEST_F(ResolutionCacheUnitTest, ResolveAgainIfResolutionIsDropped) {
+  std::string url_spec;
+  EXPECT_EQ(ResolutionCache::LookupResult::kMiss, Lookup(kHost, &url_spec));
+
+  task_environment_.FastForwardBy(base::Minutes(1));
+
+  EXPECT_EQ(ResolutionCache::LookupResult::kMiss, Lookup(kHost, &url_spec));
+
+  cache()->OnResolved(kHost, /* success */ true, kURLSpec);
+  EXPECT_EQ(std::vector<std::string>({kURLSpec, kURLSpec}), results());
+}
+
+}  // namespace decentralized_dns
@@ -4,12 +4,14 @@
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
 #include "base/containers/flat_map.h"
+#include "base/files/file_util.h"
 #include "base/memory/raw_ptr.h"
 #include "base/path_service.h"
 #include "base/run_loop.h"
 #include "base/scoped_observation.h"
 #include "base/task/post_task.h"
 #include "base/test/thread_test_helper.h"
+#include "base/threading/thread_restrictions.h"
 #include "brave/browser/brave_browser_process.h"
 #include "brave/browser/brave_rewards/rewards_service_factory.h"
 #include "brave/browser/extensions/brave_base_local_data_files_browsertest.h"
@@ -25,6 +27,7 @@
 #include "chrome/test/base/ui_test_utils.h"
 #include "content/public/test/browser_test.h"
 #include "content/public/test/browser_test_utils.h"
+#include "extensions/browser/extension_registry.h"
 #include "net/dns/mock_host_resolver.h"
 #include "ui/base/ui_base_switches.h"
 
@@ -359,6 +362,83 @@ IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, IsGreaselionExtension) {
   EXPECT_TRUE(greaselion_service->IsGreaselionExtension(extension_ids[0]));
 }
 
+// Converting the same rules again should reuse the extension directories
+// cached by the first conversion instead of writing new ones.
+IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, ReuseCachedExtension) {
+  ASSERT_TRUE(InstallMockExtension());
+
+  GreaselionService* greaselion_service =
+      GreaselionServiceFactory::GetForBrowserContext(profile());
+  ASSERT_TRUE(greaselion_service);
+
+  auto extension_ids = greaselion_service->GetExtensionIdsForTesting();
+  ASSERT_GT(extension_ids.size(), 0UL);
+  extensions::ExtensionRegistry* registry =
+      extensions::ExtensionRegistry::Get(profile());
+  const extensions::Extension* extension =
+      registry->enabled_extensions().GetByID(extension_ids[0]);
+  ASSERT_TRUE(extension);
+  const base::FilePath path = extension->path();
+
+  greaselion_service->UpdateInstalledExtensions();
+  GreaselionServiceWaiter(greaselion_service).Wait();
+
+  extension = registry->enabled_extensions().GetByID(extension_ids[0]);
+  ASSERT_TRUE(extension);
+  EXPECT_EQ(path, extension->path());
+}
+
+// Changing a rule's script should rebuild its extension in a new cache
+// directory and leave the previous build for profiles still using it.
+IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, RebuildChangedExtension) {
+  ASSERT_TRUE(InstallMockExtension());
+
+  GreaselionService* greaselion_service =
+      GreaselionServiceFactory::GetForBrowserContext(profile());
+  ASSERT_TRUE(greaselion_service);
+
+  auto extension_ids = greaselion_service->GetExtensionIdsForTesting();
+  ASSERT_GT(extension_ids.size(), 0UL);
+  extensions::ExtensionRegistry* registry =
+      extensions::ExtensionRegistry::Get(profile());
+  const extensions::Extension* extension =
+      registry->enabled_extensions().GetByID(extension_ids[0]);
+  ASSERT_TRUE(extension);
+  const base::FilePath path = extension->path();
+
+  const greaselion::GreaselionRule* rule = nullptr;
+  for (const auto& candidate :
+       *g_brave_browser_process->greaselion_download_service()->rules()) {
+    if (candidate->name() == extension->name())
+      rule = candidate.get();
+  }
+  ASSERT_TRUE(rule);
+  ASSERT_GT(rule->scripts().size(), 0UL);
+
+  // The rules point into the installed copy of the test data, so the script
+  // can be changed in place.
+  const base::FilePath script = rule->scripts()[0];
+  const std::string changed_script = "// changed\n";
+  {
+    base::ScopedAllowBlockingForTesting allow_blocking;
+    ASSERT_TRUE(base::WriteFile(script, changed_script));
+  }
+
+  greaselion_service->UpdateInstalledExtensions();
+  GreaselionServiceWaiter(greaselion_service).Wait();
+
+  extension = registry->enabled_extensions().GetByID(extension_ids[0]);
+  ASSERT_TRUE(extension);
+  EXPECT_NE(path, extension->path());
+
+  base::ScopedAllowBlockingForTesting allow_blocking;
+  std::string contents;
+  ASSERT_TRUE(base::ReadFileToString(
+      extension->path().Append(script.BaseName()), &contents));
+  EXPECT_EQ(changed_script, contents);
+  EXPECT_TRUE(base::DirectoryExists(path));
+}
+
 IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, IsNotGreaselionExtension) {
   ASSERT_TRUE(InstallMockExtension());
 
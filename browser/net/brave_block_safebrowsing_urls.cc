@@ -5,8 +5,8 @@
 
 #include "brave/browser/net/brave_block_safebrowsing_urls.h"
 
-#include <vector>
-
+#include "base/no_destructor.h"
+#include "brave/browser/net/url_pattern_host_index.h"
 #include "extensions/common/url_pattern.h"
 #include "net/base/net_errors.h"
 #include "url/gurl.h"
@@ -15,34 +15,46 @@ namespace brave {
 
 const char kDummyUrl[] = "https://no-thanks.invalid";
 
+namespace {
+
+enum class SafeBrowsingURLType {
+  kAllowed,
+  kReporting,
+};
+
+// Allowed patterns are added first so that they take precedence over the
+// reporting patterns.
+const URLPatternHostIndex& GetSafeBrowsingURLIndex() {
+  static const base::NoDestructor<URLPatternHostIndex> index([] {
+    URLPatternHostIndex index;
+    for (const char* allowed_pattern :
+         {"https://sb-ssl.google.com/safebrowsing/clientreport/download*",
+          "https://safebrowsing.google.com/safebrowsing/clientreport/"
+          "crx-list-info*"}) {
+      index.Add(static_cast<int>(SafeBrowsingURLType::kAllowed),
+                URLPattern(URLPattern::SCHEME_HTTPS, allowed_pattern));
+    }
+    for (const char* reporting_pattern :
+         {"https://sb-ssl.google.com/safebrowsing/clientreport/*",
+          "https://safebrowsing.google.com/safebrowsing/clientreport/*",
+          "https://safebrowsing.google.com/safebrowsing/report*",
+          "https://safebrowsing.google.com/safebrowsing/uploads/*"}) {
+      index.Add(static_cast<int>(SafeBrowsingURLType::kReporting),
+                URLPattern(URLPattern::SCHEME_HTTPS, reporting_pattern));
+    }
+    return index;
+  }());
+  return *index;
+}
+
+}  // namespace
+
 bool IsSafeBrowsingReportingURL(const GURL& gurl) {
-  static const std::vector<URLPattern> allowed_patterns({
-      URLPattern(
-          URLPattern::SCHEME_HTTPS,
-          "https://sb-ssl.google.com/safebrowsing/clientreport/download*"),
-      URLPattern(URLPattern::SCHEME_HTTPS,
-                 "https://safebrowsing.google.com/safebrowsing/clientreport/"
-                 "crx-list-info*"),
-  });
-  static const std::vector<URLPattern> reporting_patterns({
-      URLPattern(URLPattern::SCHEME_HTTPS,
-                 "https://sb-ssl.google.com/safebrowsing/clientreport/*"),
-      URLPattern(URLPattern::SCHEME_HTTPS,
-                 "https://safebrowsing.google.com/safebrowsing/clientreport/*"),
-      URLPattern(URLPattern::SCHEME_HTTPS,
-                 "https://safebrowsing.google.com/safebrowsing/report*"),
-      URLPattern(URLPattern::SCHEME_HTTPS,
-                 "https://safebrowsing.google.com/safebrowsing/uploads/*"),
-  });
-
-  if (std::any_of(
-          allowed_patterns.begin(), allowed_patterns.end(),
-          [&gurl](URLPattern pattern) { return pattern.MatchesURL(gurl); })) {
-    return false;
-  }
-  return std::any_of(
-      reporting_patterns.begin(), reporting_patterns.end(),
-      [&gurl](URLPattern pattern) { return pattern.MatchesURL(gurl); });
+  const absl::optional<int> url_type =
+      GetSafeBrowsingURLIndex().FindFirstMatch(gurl);
+  return url_type &&
+         static_cast<SafeBrowsingURLType>(*url_type) ==
+             SafeBrowsingURLType::kReporting;
 }
 
 int OnBeforeURLRequest_BlockSafeBrowsingReportingURLs(const GURL& request_url,
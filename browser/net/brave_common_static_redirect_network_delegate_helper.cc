@@ -8,8 +8,10 @@
 #include <memory>
 #include <string>
 
+#include "base/no_destructor.h"
 #include "base/strings/string_split.h"
 #include "base/strings/string_util.h"
+#include "brave/browser/net/url_pattern_host_index.h"
 #include "brave/common/network_constants.h"
 #include "extensions/common/url_pattern.h"
 #include "net/base/net_errors.h"
@@ -42,6 +44,30 @@ bool RewriteBugReportingURL(const GURL& request_url, GURL* new_url) {
   return true;
 }
 
+enum class CommonStaticRedirect {
+  kChromeCast,
+  kClients4,
+  kBugReporting,
+};
+
+// Patterns are checked in the order they are added.
+const URLPatternHostIndex& GetCommonStaticRedirectIndex() {
+  static const base::NoDestructor<URLPatternHostIndex> index([] {
+    constexpr int kHttpOrHttps =
+        URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS;
+    URLPatternHostIndex index;
+    index.Add(static_cast<int>(CommonStaticRedirect::kChromeCast),
+              URLPattern(kHttpOrHttps, kChromeCastPrefix));
+    index.AddHost(static_cast<int>(CommonStaticRedirect::kClients4),
+                  URLPattern(kHttpOrHttps, kClients4Prefix));
+    index.Add(static_cast<int>(CommonStaticRedirect::kBugReporting),
+              URLPattern(kHttpOrHttps,
+                         "*://bugs.chromium.org/p/chromium/issues/entry?*"));
+    return index;
+  }());
+  return *index;
+}
+
 }  // namespace
 
 int OnBeforeURLRequest_CommonStaticRedirectWork(
@@ -61,31 +87,27 @@ int OnBeforeURLRequest_CommonStaticRedirectWorkForGURL(
     GURL* new_url) {
   DCHECK(new_url);
 
-  GURL::Replacements replacements;
-  static URLPattern chromecast_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kChromeCastPrefix);
-  static URLPattern clients4_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kClients4Prefix);
-  static URLPattern bugsChromium_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS,
-      "*://bugs.chromium.org/p/chromium/issues/entry?*");
-
-  if (chromecast_pattern.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr(kBraveRedirectorProxy);
-    *new_url = request_url.ReplaceComponents(replacements);
+  const absl::optional<int> redirect =
+      GetCommonStaticRedirectIndex().FindFirstMatch(request_url);
+  if (!redirect)
     return net::OK;
-  }
 
-  if (clients4_pattern.MatchesHost(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr(kBraveClients4Proxy);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
+  GURL::Replacements replacements;
+  switch (static_cast<CommonStaticRedirect>(*redirect)) {
+    case CommonStaticRedirect::kChromeCast:
+      replacements.SetSchemeStr("https");
+      replacements.SetHostStr(kBraveRedirectorProxy);
+      *new_url = request_url.ReplaceComponents(replacements);
+      return net::OK;
+
+    case CommonStaticRedirect::kClients4:
+      replacements.SetSchemeStr("https");
+      replacements.SetHostStr(kBraveClients4Proxy);
+      *new_url = request_url.ReplaceComponents(replacements);
+      return net::OK;
 
-  if (bugsChromium_pattern.MatchesURL(request_url)) {
-    if (RewriteBugReportingURL(request_url, new_url))
+    case CommonStaticRedirect::kBugReporting:
+      RewriteBugReportingURL(request_url, new_url);
       return net::OK;
   }
 
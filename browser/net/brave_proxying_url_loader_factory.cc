@@ -149,7 +149,7 @@ void BraveProxyingURLLoaderFactory::InProgressRequest::RestartInternal() {
   int result = factory_->request_handler_->OnBeforeURLRequest(
       ctx_, continuation, &redirect_url_);
 
-  if (result == net::ERR_BLOCKED_BY_CLIENT) {
+  if (result != net::OK && result != net::ERR_IO_PENDING) {
     // The request was cancelled synchronously. Dispatch an error notification
     // and terminate the request.
     network::URLLoaderCompletionStatus status(result);
@@ -408,7 +408,7 @@ void BraveProxyingURLLoaderFactory::InProgressRequest::
     int result = factory_->request_handler_->OnBeforeStartTransaction(
         ctx_, continuation, &request_.headers);
 
-    if (result == net::ERR_BLOCKED_BY_CLIENT) {
+    if (result != net::OK && result != net::ERR_IO_PENDING) {
       // The request was cancelled synchronously. Dispatch an error notification
       // and terminate the request.
       OnRequestError(network::URLLoaderCompletionStatus(result));
@@ -596,7 +596,7 @@ void BraveProxyingURLLoaderFactory::InProgressRequest::
         current_response_head_->headers.get(), &override_headers_,
         &redirect_url_);
 
-    if (result == net::ERR_BLOCKED_BY_CLIENT) {
+    if (result != net::OK && result != net::ERR_IO_PENDING) {
       OnRequestError(network::URLLoaderCompletionStatus(result));
       return;
     }
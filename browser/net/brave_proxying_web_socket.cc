@@ -101,7 +101,7 @@ void BraveProxyingWebSocket::Start() {
       ctx_, continuation, &redirect_url_);
   // TODO(bridiver) - need to handle general case for redirect_url
 
-  if (result == net::ERR_BLOCKED_BY_CLIENT ||
+  if ((result != net::OK && result != net::ERR_IO_PENDING) ||
       // handle adblock kEmptyDataURI
       redirect_url_ == kEmptyDataURI) {
     OnError(result);
@@ -174,7 +174,7 @@ void BraveProxyingWebSocket::ContinueToHeadersReceived() {
       ctx_, continuation, response_.headers.get(),
       &override_headers_, &redirect_url_);
 
-  if (result == net::ERR_BLOCKED_BY_CLIENT ||
+  if ((result != net::OK && result != net::ERR_IO_PENDING) ||
       // handle adblock kEmptyDataURI
       redirect_url_ == kEmptyDataURI) {
     OnError(result);
@@ -287,7 +287,7 @@ void BraveProxyingWebSocket::OnBeforeSendHeadersCompleteFromProxy(
   int result = request_handler_->OnBeforeStartTransaction(
       ctx_, continuation, &request_.headers);
 
-  if (result == net::ERR_BLOCKED_BY_CLIENT) {
+  if (result != net::OK && result != net::ERR_IO_PENDING) {
     OnError(result);
     return;
   }
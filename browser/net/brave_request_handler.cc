@@ -143,9 +143,7 @@ int BraveRequestHandler::OnBeforeURLRequest(
   }
   ctx->new_url = new_url;
   ctx->event_type = brave::kOnBeforeRequest;
-  callbacks_[ctx->request_identifier] = std::move(callback);
-  RunNextCallback(ctx);
-  return net::ERR_IO_PENDING;
+  return StartCallbacks(ctx, std::move(callback));
 }
 
 int BraveRequestHandler::OnBeforeStartTransaction(
@@ -157,9 +155,7 @@ int BraveRequestHandler::OnBeforeStartTransaction(
   }
   ctx->event_type = brave::kOnBeforeStartTransaction;
   ctx->headers = headers;
-  callbacks_[ctx->request_identifier] = std::move(callback);
-  RunNextCallback(ctx);
-  return net::ERR_IO_PENDING;
+  return StartCallbacks(ctx, std::move(callback));
 }
 
 int BraveRequestHandler::OnHeadersReceived(
@@ -180,14 +176,12 @@ int BraveRequestHandler::OnHeadersReceived(
     return net::OK;
   }
 
-  callbacks_[ctx->request_identifier] = std::move(callback);
   ctx->event_type = brave::kOnHeadersReceived;
   ctx->original_response_headers = original_response_headers;
   ctx->override_response_headers = override_response_headers;
   ctx->allowed_unsafe_redirect_url = allowed_unsafe_redirect_url;
 
-  RunNextCallback(ctx);
-  return net::ERR_IO_PENDING;
+  return StartCallbacks(ctx, std::move(callback));
 }
 
 void BraveRequestHandler::OnURLRequestDestroyed(
@@ -202,14 +196,31 @@ void BraveRequestHandler::RunCallbackForRequestIdentifier(
     int rv) {
   std::map<uint64_t, net::CompletionOnceCallback>::iterator it =
       callbacks_.find(request_identifier);
-  // We intentionally do the async call to maintain the proper flow
-  // of URLLoader callbacks.
+  // Only reached once a helper went pending, after ERR_IO_PENDING was
+  // returned to the caller. Post the completion so that it doesn't run
+  // re-entrantly from within the helper's own callback.
   base::PostTask(FROM_HERE, {content::BrowserThread::UI},
                  base::BindOnce(std::move(it->second), rv));
 }
 
-// TODO(iefremov): Merge all callback containers into one and run only one loop
-// instead of many (issues/5574).
+void BraveRequestHandler::SetOnBeforeURLRequestCallbacksForTesting(
+    std::vector<brave::OnBeforeURLRequestCallback> callbacks) {
+  before_url_request_callbacks_ = std::move(callbacks);
+}
+
+int BraveRequestHandler::StartCallbacks(
+    std::shared_ptr<brave::BraveRequestInfo> ctx,
+    net::CompletionOnceCallback callback) {
+  callbacks_[ctx->request_identifier] = std::move(callback);
+  // Most requests are not touched by any helper and every helper finishes
+  // synchronously. Report the result right away in that case instead of
+  // bouncing the request through an extra UI thread task.
+  const int rv = RunCallbacks(ctx);
+  if (rv != net::ERR_IO_PENDING)
+    callbacks_.erase(ctx->request_identifier);
+  return rv;
+}
+
 void BraveRequestHandler::RunNextCallback(
     std::shared_ptr<brave::BraveRequestInfo> ctx) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
@@ -218,6 +229,17 @@ void BraveRequestHandler::RunNextCallback(
     return;
   }
 
+  const int rv = RunCallbacks(ctx);
+  if (rv != net::ERR_IO_PENDING)
+    RunCallbackForRequestIdentifier(ctx->request_identifier, rv);
+}
+
+// TODO(iefremov): Merge all callback containers into one and run only one loop
+// instead of many (issues/5574).
+int BraveRequestHandler::RunCallbacks(
+    std::shared_ptr<brave::BraveRequestInfo> ctx) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+
   // Continue processing callbacks until we hit one that returns PENDING
   int rv = net::OK;
 
@@ -231,7 +253,7 @@ void BraveRequestHandler::RunNextCallback(
                               weak_factory_.GetWeakPtr(), ctx);
       rv = callback.Run(next_callback, ctx);
       if (rv == net::ERR_IO_PENDING) {
-        return;
+        return rv;
       }
       if (rv != net::OK) {
         break;
@@ -247,7 +269,7 @@ void BraveRequestHandler::RunNextCallback(
                               weak_factory_.GetWeakPtr(), ctx);
       rv = callback.Run(ctx->headers, next_callback, ctx);
       if (rv == net::ERR_IO_PENDING) {
-        return;
+        return rv;
       }
       if (rv != net::OK) {
         break;
@@ -264,7 +286,7 @@ void BraveRequestHandler::RunNextCallback(
                         ctx->override_response_headers,
                         ctx->allowed_unsafe_redirect_url, next_callback, ctx);
       if (rv == net::ERR_IO_PENDING) {
-        return;
+        return rv;
       }
       if (rv != net::OK) {
         break;
@@ -273,8 +295,7 @@ void BraveRequestHandler::RunNextCallback(
   }
 
   if (rv != net::OK) {
-    RunCallbackForRequestIdentifier(ctx->request_identifier, rv);
-    return;
+    return rv;
   }
 
   if (ctx->event_type == brave::kOnBeforeRequest) {
@@ -286,11 +307,9 @@ void BraveRequestHandler::RunNextCallback(
     if (ctx->blocked_by == brave::kAdBlocked ||
         ctx->blocked_by == brave::kOtherBlocked) {
       if (!ctx->ShouldMockRequest()) {
-        RunCallbackForRequestIdentifier(ctx->request_identifier,
-                                        net::ERR_BLOCKED_BY_CLIENT);
-        return;
+        return net::ERR_BLOCKED_BY_CLIENT;
       }
     }
   }
-  RunCallbackForRequestIdentifier(ctx->request_identifier, rv);
+  return rv;
 }
@@ -45,9 +45,18 @@ class BraveRequestHandler {
   void OnURLRequestDestroyed(std::shared_ptr<brave::BraveRequestInfo> ctx);
   void RunCallbackForRequestIdentifier(uint64_t request_identifier, int rv);
 
+  void SetOnBeforeURLRequestCallbacksForTesting(
+      std::vector<brave::OnBeforeURLRequestCallback> callbacks);
+
  private:
   void SetupCallbacks();
+  // Runs the callbacks for the current event of |ctx|. Returns the result
+  // directly when all of them complete synchronously, otherwise returns
+  // net::ERR_IO_PENDING and |callback| is run asynchronously later.
+  int StartCallbacks(std::shared_ptr<brave::BraveRequestInfo> ctx,
+                     net::CompletionOnceCallback callback);
   void RunNextCallback(std::shared_ptr<brave::BraveRequestInfo> ctx);
+  int RunCallbacks(std::shared_ptr<brave::BraveRequestInfo> ctx);
 
   std::vector<brave::OnBeforeURLRequestCallback> before_url_request_callbacks_;
   std::vector<brave::OnBeforeStartTransactionCallback>
@@ -0,0 +1,129 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/brave_request_handler.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "base/bind.h"
+#include "base/test/bind.h"
+#include "brave/browser/net/url_context.h"
+#include "content/public/test/browser_task_environment.h"
+#include "net/base/net_errors.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace {
+
+constexpr char kRequestURL[] = "https://example.com/";
+constexpr char kRedirectURL[] = "https://brave.com/";
+
+}  // namespace
+
+class BraveRequestHandlerTest : public testing::Test {
+ public:
+  BraveRequestHandlerTest()
+      : ctx_(std::make_shared<brave::BraveRequestInfo>(GURL(kRequestURL))) {
+    ctx_->request_identifier = 1;
+  }
+
+  ~BraveRequestHandlerTest() override = default;
+
+  int OnBeforeURLRequest() {
+    return handler_.OnBeforeURLRequest(
+        ctx_, base::BindLambdaForTesting([&](int rv) {
+          completion_results_.push_back(rv);
+        }),
+        &new_url_);
+  }
+
+  // Returns a helper which records that it ran and returns |rv|.
+  brave::OnBeforeURLRequestCallback MakeCallback(int rv) {
+    return base::BindLambdaForTesting(
+        [this, rv](const brave::ResponseCallback& next_callback,
+                   std::shared_ptr<brave::BraveRequestInfo> ctx) {
+          ++callback_run_count_;
+          return rv;
+        });
+  }
+
+  // Returns a helper which redirects the request to |kRedirectURL|.
+  brave::OnBeforeURLRequestCallback MakeRedirectCallback() {
+    return base::BindLambdaForTesting(
+        [this](const brave::ResponseCallback& next_callback,
+               std::shared_ptr<brave::BraveRequestInfo> ctx) {
+          ++callback_run_count_;
+          ctx->new_url_spec = kRedirectURL;
+          return net::OK;
+        });
+  }
+
+ protected:
+  content::BrowserTaskEnvironment task_environment_;
+  BraveRequestHandler handler_;
+  std::shared_ptr<brave::BraveRequestInfo> ctx_;
+  GURL new_url_;
+  int callback_run_count_ = 0;
+  std::vector<int> completion_results_;
+};
+
+TEST_F(BraveRequestHandlerTest, AllCallbacksCompleteSynchronously) {
+  handler_.SetOnBeforeURLRequestCallbacksForTesting(
+      {MakeCallback(net::OK), MakeRedirectCallback(), MakeCallback(net::OK)});
+
+  EXPECT_EQ(net::OK, OnBeforeURLRequest());
+  EXPECT_EQ(3, callback_run_count_);
+  EXPECT_EQ(GURL(kRedirectURL), new_url_);
+  EXPECT_FALSE(handler_.IsRequestIdentifierValid(ctx_->request_identifier));
+
+  // The result was returned directly, so the completion callback never runs.
+  task_environment_.RunUntilIdle();
+  EXPECT_TRUE(completion_results_.empty());
+}
+
+TEST_F(BraveRequestHandlerTest, CallbackBlocksSynchronously) {
+  handler_.SetOnBeforeURLRequestCallbacksForTesting(
+      {MakeCallback(net::OK), MakeCallback(net::ERR_BLOCKED_BY_CLIENT),
+       MakeCallback(net::OK)});
+
+  EXPECT_EQ(net::ERR_BLOCKED_BY_CLIENT, OnBeforeURLRequest());
+  // Helpers after the blocking one are skipped.
+  EXPECT_EQ(2, callback_run_count_);
+  EXPECT_TRUE(new_url_.is_empty());
+  EXPECT_FALSE(handler_.IsRequestIdentifierValid(ctx_->request_identifier));
+
+  task_environment_.RunUntilIdle();
+  EXPECT_TRUE(completion_results_.empty());
+}
+
+TEST_F(BraveRequestHandlerTest, CallbackCompletesAsynchronously) {
+  brave::ResponseCallback pending_next_callback;
+  brave::OnBeforeURLRequestCallback pending_callback =
+      base::BindLambdaForTesting(
+          [&](const brave::ResponseCallback& next_callback,
+              std::shared_ptr<brave::BraveRequestInfo> ctx) {
+            ++callback_run_count_;
+            pending_next_callback = next_callback;
+            return net::ERR_IO_PENDING;
+          });
+  handler_.SetOnBeforeURLRequestCallbacksForTesting(
+      {MakeCallback(net::OK), pending_callback, MakeRedirectCallback()});
+
+  EXPECT_EQ(net::ERR_IO_PENDING, OnBeforeURLRequest());
+  EXPECT_EQ(2, callback_run_count_);
+  EXPECT_TRUE(handler_.IsRequestIdentifierValid(ctx_->request_identifier));
+  ASSERT_FALSE(pending_next_callback.is_null());
+
+  // Resuming runs the remaining helpers, then posts the completion.
+  pending_next_callback.Run();
+  EXPECT_EQ(3, callback_run_count_);
+  EXPECT_EQ(GURL(kRedirectURL), new_url_);
+  EXPECT_TRUE(completion_results_.empty());
+
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(std::vector<int>({net::OK}), completion_results_);
+}
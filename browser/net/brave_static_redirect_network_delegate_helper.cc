@@ -5,12 +5,13 @@
 
 #include "brave/browser/net/brave_static_redirect_network_delegate_helper.h"
 
-#include <algorithm>
 #include <memory>
 #include <string>
-#include <vector>
+#include <utility>
 
+#include "base/no_destructor.h"
 #include "base/strings/string_piece_forward.h"
+#include "brave/browser/net/url_pattern_host_index.h"
 #include "brave/common/network_constants.h"
 #include "extensions/common/url_pattern.h"
 #include "net/base/net_errors.h"
@@ -29,6 +30,64 @@ base::StringPiece GetSafeBrowsingEndpoint() {
   return SAFEBROWSING_ENDPOINT;
 }
 
+enum class StaticRedirect {
+  kGeoLocation,
+  kSafeBrowsing,
+  kSafeBrowsingFileCheck,
+  kSafeBrowsingCrxList,
+  kCrxDownload,
+  kAutofill,
+  kCRLSet,
+  kComponentDownload,
+};
+
+// Patterns are checked in the order they are added.
+const URLPatternHostIndex& GetStaticRedirectIndex() {
+  static const base::NoDestructor<URLPatternHostIndex> index([] {
+    constexpr int kHttpOrHttps =
+        URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS;
+    auto add = [](URLPatternHostIndex* index, StaticRedirect redirect,
+                  const URLPattern& pattern,
+                  absl::optional<URLPattern> except = absl::nullopt) {
+      index->Add(static_cast<int>(redirect), pattern, std::move(except));
+    };
+    auto add_host = [](URLPatternHostIndex* index, StaticRedirect redirect,
+                       const URLPattern& pattern) {
+      index->AddHost(static_cast<int>(redirect), pattern);
+    };
+
+    URLPatternHostIndex index;
+    add(&index, StaticRedirect::kGeoLocation,
+        URLPattern(URLPattern::SCHEME_HTTPS, kGeoLocationsPattern));
+    add_host(&index, StaticRedirect::kSafeBrowsing,
+             URLPattern(URLPattern::SCHEME_HTTPS, kSafeBrowsingPrefix));
+    add_host(
+        &index, StaticRedirect::kSafeBrowsingFileCheck,
+        URLPattern(URLPattern::SCHEME_HTTPS, kSafeBrowsingFileCheckPrefix));
+    add_host(&index, StaticRedirect::kSafeBrowsingCrxList,
+             URLPattern(URLPattern::SCHEME_HTTPS, kSafeBrowsingCrxListPrefix));
+    add(&index, StaticRedirect::kCrxDownload,
+        URLPattern(kHttpOrHttps, kCRXDownloadPrefix));
+    add(&index, StaticRedirect::kAutofill,
+        URLPattern(URLPattern::SCHEME_HTTPS, kAutofillPrefix));
+    // To-Do (@jumde) - Update the naming for the variables below
+    // https://github.com/brave/brave-browser/issues/10314
+    for (const char* crl_set_prefix :
+         {kCRLSetPrefix1, kCRLSetPrefix2, kCRLSetPrefix3, kCRLSetPrefix4}) {
+      add(&index, StaticRedirect::kCRLSet,
+          URLPattern(kHttpOrHttps, crl_set_prefix));
+    }
+    add(&index, StaticRedirect::kComponentDownload,
+        URLPattern(kHttpOrHttps, "*://*.gvt1.com/*"),
+        URLPattern(kHttpOrHttps, kWidevineGvt1Prefix));
+    add(&index, StaticRedirect::kComponentDownload,
+        URLPattern(kHttpOrHttps, "*://dl.google.com/*"),
+        URLPattern(kHttpOrHttps, kWidevineGoogleDlPrefix));
+    return index;
+  }());
+  return *index;
+}
+
 }  // namespace
 
 void SetSafeBrowsingEndpointForTesting(bool testing) {
@@ -50,127 +109,58 @@ int OnBeforeURLRequest_StaticRedirectWork(
 int OnBeforeURLRequest_StaticRedirectWorkForGURL(
     const GURL& request_url,
     GURL* new_url) {
-  GURL::Replacements replacements;
-  static URLPattern geo_pattern(URLPattern::SCHEME_HTTPS, kGeoLocationsPattern);
-  static URLPattern safeBrowsing_pattern(URLPattern::SCHEME_HTTPS,
-                                         kSafeBrowsingPrefix);
-  static URLPattern safebrowsingfilecheck_pattern(URLPattern::SCHEME_HTTPS,
-                                                  kSafeBrowsingFileCheckPrefix);
-  static URLPattern safebrowsingcrxlist_pattern(URLPattern::SCHEME_HTTPS,
-                                                kSafeBrowsingCrxListPrefix);
-
-  // To-Do (@jumde) - Update the naming for the variables below
-  // https://github.com/brave/brave-browser/issues/10314
-  static URLPattern crlSet_pattern1(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kCRLSetPrefix1);
-  static URLPattern crlSet_pattern2(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kCRLSetPrefix2);
-  static URLPattern crlSet_pattern3(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kCRLSetPrefix3);
-  static URLPattern crlSet_pattern4(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kCRLSetPrefix4);
-  static URLPattern crxDownload_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kCRXDownloadPrefix);
-  static URLPattern autofill_pattern(
-      URLPattern::SCHEME_HTTPS, kAutofillPrefix);
-  static URLPattern gvt1_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, "*://*.gvt1.com/*");
-  static URLPattern googleDl_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS,
-      "*://dl.google.com/*");
-
-  static URLPattern widevine_gvt1_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS,
-      kWidevineGvt1Prefix);
-  static URLPattern widevine_google_dl_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS,
-      kWidevineGoogleDlPrefix);
-
-  if (geo_pattern.MatchesURL(request_url)) {
-    *new_url = GURL(GOOGLEAPIS_ENDPOINT GOOGLEAPIS_API_KEY);
+  const absl::optional<int> redirect =
+      GetStaticRedirectIndex().FindFirstMatch(request_url);
+  if (!redirect)
     return net::OK;
-  }
 
+  GURL::Replacements replacements;
   auto safebrowsing_endpoint = GetSafeBrowsingEndpoint();
-  if (!safebrowsing_endpoint.empty() &&
-      safeBrowsing_pattern.MatchesHost(request_url)) {
-    replacements.SetHostStr(safebrowsing_endpoint);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (!safebrowsing_endpoint.empty() &&
-      safebrowsingfilecheck_pattern.MatchesHost(request_url)) {
-    replacements.SetHostStr(kBraveSafeBrowsingSslProxy);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (!safebrowsing_endpoint.empty() &&
-      safebrowsingcrxlist_pattern.MatchesHost(request_url)) {
-    replacements.SetHostStr(kBraveSafeBrowsing2Proxy);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (crxDownload_pattern.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr("crxdownload.brave.com");
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (autofill_pattern.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr(kBraveStaticProxy);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (crlSet_pattern1.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr("redirector.brave.com");
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (crlSet_pattern2.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr("redirector.brave.com");
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (crlSet_pattern3.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr("redirector.brave.com");
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (crlSet_pattern4.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr("redirector.brave.com");
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (gvt1_pattern.MatchesURL(request_url) &&
-      !widevine_gvt1_pattern.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr(kBraveRedirectorProxy);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (googleDl_pattern.MatchesURL(request_url) &&
-      !widevine_google_dl_pattern.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr(kBraveRedirectorProxy);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
+  switch (static_cast<StaticRedirect>(*redirect)) {
+    case StaticRedirect::kGeoLocation:
+      *new_url = GURL(GOOGLEAPIS_ENDPOINT GOOGLEAPIS_API_KEY);
+      return net::OK;
+
+    case StaticRedirect::kSafeBrowsing:
+      if (safebrowsing_endpoint.empty())
+        return net::OK;
+      replacements.SetHostStr(safebrowsing_endpoint);
+      break;
+
+    case StaticRedirect::kSafeBrowsingFileCheck:
+      if (safebrowsing_endpoint.empty())
+        return net::OK;
+      replacements.SetHostStr(kBraveSafeBrowsingSslProxy);
+      break;
+
+    case StaticRedirect::kSafeBrowsingCrxList:
+      if (safebrowsing_endpoint.empty())
+        return net::OK;
+      replacements.SetHostStr(kBraveSafeBrowsing2Proxy);
+      break;
+
+    case StaticRedirect::kCrxDownload:
+      replacements.SetSchemeStr("https");
+      replacements.SetHostStr("crxdownload.brave.com");
+      break;
+
+    case StaticRedirect::kAutofill:
+      replacements.SetSchemeStr("https");
+      replacements.SetHostStr(kBraveStaticProxy);
+      break;
+
+    case StaticRedirect::kCRLSet:
+      replacements.SetSchemeStr("https");
+      replacements.SetHostStr("redirector.brave.com");
+      break;
+
+    case StaticRedirect::kComponentDownload:
+      replacements.SetSchemeStr("https");
+      replacements.SetHostStr(kBraveRedirectorProxy);
+      break;
   }
 
+  *new_url = request_url.ReplaceComponents(replacements);
   return net::OK;
 }
 
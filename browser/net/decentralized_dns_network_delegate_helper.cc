@@ -12,6 +12,7 @@
 #include "brave/components/brave_wallet/browser/json_rpc_service.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
 #include "brave/components/decentralized_dns/constants.h"
+#include "brave/components/decentralized_dns/resolution_cache.h"
 #include "brave/components/decentralized_dns/utils.h"
 #include "brave/components/ipfs/ipfs_utils.h"
 #include "chrome/browser/browser_process.h"
@@ -26,6 +27,25 @@ std::string GetValue(const std::vector<std::string>& arr, RecordKeys key) {
   return arr[static_cast<size_t>(key)];
 }
 
+void OnResolutionLookup(const brave::ResponseCallback& next_callback,
+                        std::shared_ptr<brave::BraveRequestInfo> ctx,
+                        const std::string& url_spec) {
+  if (!url_spec.empty())
+    ctx->new_url_spec = url_spec;
+
+  if (!next_callback.is_null())
+    next_callback.Run();
+}
+
+void MaybeCacheResolution(std::shared_ptr<brave::BraveRequestInfo> ctx,
+                          bool success) {
+  if (!ctx->browser_context)
+    return;
+
+  ResolutionCache::GetForBrowserContext(ctx->browser_context)
+      ->OnResolved(ctx->request_url.host(), success, ctx->new_url_spec);
+}
+
 }  // namespace
 
 int OnBeforeURLRequest_DecentralizedDnsPreRedirectWork(
@@ -42,30 +62,77 @@ int OnBeforeURLRequest_DecentralizedDnsPreRedirectWork(
   if (!json_rpc_service)
     return net::OK;
 
-  if (IsUnstoppableDomainsTLD(ctx->request_url) &&
+  const bool should_resolve_unstoppable_domains =
+      IsUnstoppableDomainsTLD(ctx->request_url) &&
       IsUnstoppableDomainsResolveMethodEthereum(
-          g_browser_process->local_state())) {
+          g_browser_process->local_state());
+  const bool should_resolve_ens =
+      IsENSTLD(ctx->request_url) &&
+      IsENSResolveMethodEthereum(g_browser_process->local_state());
+  if (!should_resolve_unstoppable_domains && !should_resolve_ens)
+    return net::OK;
+
+  // Subresources of a decentralized site share its host, so look up earlier
+  // resolutions before issuing eth_call requests.
+  std::string url_spec;
+  const ResolutionCache::LookupResult lookup_result =
+      ResolutionCache::GetForBrowserContext(ctx->browser_context)
+          ->Lookup(ctx->request_url.host(), &url_spec,
+                   base::BindOnce(&OnResolutionLookup, next_callback, ctx));
+  switch (lookup_result) {
+    case ResolutionCache::LookupResult::kHit: {
+      if (!url_spec.empty())
+        ctx->new_url_spec = url_spec;
+      return net::OK;
+    }
+
+    case ResolutionCache::LookupResult::kStaleHit: {
+      // Use the stale resolution and refresh it without holding up this
+      // request.
+      if (!url_spec.empty())
+        ctx->new_url_spec = url_spec;
+      break;
+    }
+
+    case ResolutionCache::LookupResult::kPending: {
+      return net::ERR_IO_PENDING;
+    }
+
+    case ResolutionCache::LookupResult::kMiss: {
+      break;
+    }
+  }
+
+  // Resolve into a separate request info so that the cached resolution only
+  // reflects the records. Pending lookups, including the one for this request
+  // on a miss, are run once the resolution is cached.
+  auto resolve_ctx =
+      std::make_shared<brave::BraveRequestInfo>(ctx->request_url);
+  resolve_ctx->browser_context = ctx->browser_context;
+  const brave::ResponseCallback resolve_callback;
+
+  const int rv = lookup_result == ResolutionCache::LookupResult::kStaleHit
+                     ? net::OK
+                     : net::ERR_IO_PENDING;
+
+  if (should_resolve_unstoppable_domains) {
     auto keys = std::vector<std::string>(std::begin(kRecordKeys),
                                          std::end(kRecordKeys));
     json_rpc_service->UnstoppableDomainsProxyReaderGetMany(
-        brave_wallet::mojom::kMainnetChainId, ctx->request_url.host(), keys,
+        brave_wallet::mojom::kMainnetChainId, resolve_ctx->request_url.host(),
+        keys,
         base::BindOnce(&OnBeforeURLRequest_UnstoppableDomainsRedirectWork,
-                       next_callback, ctx));
+                       resolve_callback, resolve_ctx));
 
-    return net::ERR_IO_PENDING;
+    return rv;
   }
 
-  if (IsENSTLD(ctx->request_url) &&
-      IsENSResolveMethodEthereum(g_browser_process->local_state())) {
-    json_rpc_service->EnsResolverGetContentHash(
-        brave_wallet::mojom::kMainnetChainId, ctx->request_url.host(),
-        base::BindOnce(&OnBeforeURLRequest_EnsRedirectWork, next_callback,
-                       ctx));
-
-    return net::ERR_IO_PENDING;
-  }
+  json_rpc_service->EnsResolverGetContentHash(
+      brave_wallet::mojom::kMainnetChainId, resolve_ctx->request_url.host(),
+      base::BindOnce(&OnBeforeURLRequest_EnsRedirectWork, resolve_callback,
+                     resolve_ctx));
 
-  return net::OK;
+  return rv;
 }
 
 void OnBeforeURLRequest_EnsRedirectWork(
@@ -75,6 +142,7 @@ void OnBeforeURLRequest_EnsRedirectWork(
     brave_wallet::mojom::ProviderError error,
     const std::string& error_message) {
   if (error != brave_wallet::mojom::ProviderError::kSuccess) {
+    MaybeCacheResolution(ctx, /* success */ false);
     if (!next_callback.is_null())
       next_callback.Run();
     return;
@@ -85,6 +153,7 @@ void OnBeforeURLRequest_EnsRedirectWork(
     ctx->new_url_spec = ipfs_uri.spec();
   }
 
+  MaybeCacheResolution(ctx, /* success */ true);
   if (!next_callback.is_null())
     next_callback.Run();
 }
@@ -97,6 +166,7 @@ void OnBeforeURLRequest_UnstoppableDomainsRedirectWork(
     const std::string& error_message) {
   if (error != brave_wallet::mojom::ProviderError::kSuccess ||
       values.size() != static_cast<size_t>(RecordKeys::MAX_RECORD_KEY) + 1) {
+    MaybeCacheResolution(ctx, /* success */ false);
     if (!next_callback.is_null())
       next_callback.Run();
     return;
@@ -125,6 +195,7 @@ void OnBeforeURLRequest_UnstoppableDomainsRedirectWork(
     ctx->new_url_spec = GURL(fallback_url).spec();
   }
 
+  MaybeCacheResolution(ctx, /* success */ true);
   if (!next_callback.is_null())
     next_callback.Run();
 }
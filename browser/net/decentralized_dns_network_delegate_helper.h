@@ -18,6 +18,7 @@ namespace decentralized_dns {
 
 // Issue eth_call requests via Ethereum provider such as Infura to query
 // decentralized DNS records, and redirect URL requests based on them.
+// Resolutions are cached per profile, see ResolutionCache.
 int OnBeforeURLRequest_DecentralizedDnsPreRedirectWork(
     const brave::ResponseCallback& next_callback,
     std::shared_ptr<brave::BraveRequestInfo> ctx);
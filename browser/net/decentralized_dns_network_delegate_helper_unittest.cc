@@ -6,21 +6,32 @@
 #include "brave/browser/net/decentralized_dns_network_delegate_helper.h"
 
 #include <memory>
+#include <string>
+#include <vector>
 
+#include "base/bind.h"
+#include "base/test/bind.h"
 #include "base/test/scoped_feature_list.h"
+#include "brave/browser/brave_wallet/json_rpc_service_factory.h"
 #include "brave/browser/net/url_context.h"
+#include "brave/components/brave_wallet/browser/json_rpc_service.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_utils.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
 #include "brave/components/decentralized_dns/constants.h"
 #include "brave/components/decentralized_dns/features.h"
 #include "brave/components/decentralized_dns/pref_names.h"
+#include "brave/components/decentralized_dns/resolution_cache.h"
 #include "brave/components/decentralized_dns/utils.h"
 #include "chrome/test/base/scoped_testing_local_state.h"
 #include "chrome/test/base/testing_browser_process.h"
 #include "chrome/test/base/testing_profile.h"
+#include "components/keyed_service/core/keyed_service.h"
 #include "components/prefs/testing_pref_service.h"
+#include "components/user_prefs/user_prefs.h"
 #include "content/public/test/browser_task_environment.h"
 #include "net/base/net_errors.h"
+#include "services/network/public/cpp/weak_wrapper_shared_url_loader_factory.h"
+#include "services/network/test/test_url_loader_factory.h"
 #include "testing/gtest/include/gtest/gtest.h"
 #include "url/gurl.h"
 
@@ -28,17 +39,92 @@ using brave::ResponseCallback;
 
 namespace decentralized_dns {
 
+namespace {
+
+constexpr char kIpfsURLSpec[] =
+    "ipfs://QmWrdNJWMbvRxxzLhojVKaBDswS4KNVM7LvjsN7QbDrvka";
+
+// getMany response with "QmWrdNJWMbvRxxzLhojVKaBDswS4KNVM7LvjsN7QbDrvka" as
+// dweb.ipfs.hash and all other records empty.
+constexpr char kIpfsHashResponse[] =
+    "{\"jsonrpc\":\"2.0\",\"id\":1,\"result\":"
+    // offset for array
+    "\"0x0000000000000000000000000000000000000000000000000000000000000020"
+    // count for array
+    "0000000000000000000000000000000000000000000000000000000000000006"
+    // offsets for array elements
+    "00000000000000000000000000000000000000000000000000000000000000c0"
+    "0000000000000000000000000000000000000000000000000000000000000120"
+    "0000000000000000000000000000000000000000000000000000000000000140"
+    "0000000000000000000000000000000000000000000000000000000000000160"
+    "0000000000000000000000000000000000000000000000000000000000000180"
+    "00000000000000000000000000000000000000000000000000000000000001a0"
+    // count for "QmWrdNJWMbvRxxzLhojVKaBDswS4KNVM7LvjsN7QbDrvka"
+    "000000000000000000000000000000000000000000000000000000000000002e"
+    // encoding for "QmWrdNJWMbvRxxzLhojVKaBDswS4KNVM7LvjsN7QbDrvka"
+    "516d5772644e4a574d62765278787a4c686f6a564b614244737753344b4e564d"
+    "374c766a734e3751624472766b61000000000000000000000000000000000000"
+    // counts for empty ipfs.html.value, dns.A, dns.AAAA,
+    // browser.redirect_url and ipfs.redirect_domain.value
+    "0000000000000000000000000000000000000000000000000000000000000000"
+    "0000000000000000000000000000000000000000000000000000000000000000"
+    "0000000000000000000000000000000000000000000000000000000000000000"
+    "0000000000000000000000000000000000000000000000000000000000000000"
+    "0000000000000000000000000000000000000000000000000000000000000000\"}";
+
+// getMany response with all records empty.
+constexpr char kNoRecordsResponse[] =
+    "{\"jsonrpc\":\"2.0\",\"id\":1,\"result\":"
+    // offset for array
+    "\"0x0000000000000000000000000000000000000000000000000000000000000020"
+    // count for array
+    "0000000000000000000000000000000000000000000000000000000000000006"
+    // offsets for array elements
+    "00000000000000000000000000000000000000000000000000000000000000c0"
+    "00000000000000000000000000000000000000000000000000000000000000e0"
+    "0000000000000000000000000000000000000000000000000000000000000100"
+    "0000000000000000000000000000000000000000000000000000000000000120"
+    "0000000000000000000000000000000000000000000000000000000000000140"
+    "0000000000000000000000000000000000000000000000000000000000000160"
+    // counts for all six empty records
+    "0000000000000000000000000000000000000000000000000000000000000000"
+    "0000000000000000000000000000000000000000000000000000000000000000"
+    "0000000000000000000000000000000000000000000000000000000000000000"
+    "0000000000000000000000000000000000000000000000000000000000000000"
+    "0000000000000000000000000000000000000000000000000000000000000000"
+    "0000000000000000000000000000000000000000000000000000000000000000\"}";
+
+}  // namespace
+
 class DecentralizedDnsNetworkDelegateHelperTest : public testing::Test {
  public:
   DecentralizedDnsNetworkDelegateHelperTest()
-      : local_state_(std::make_unique<ScopedTestingLocalState>(
-            TestingBrowserProcess::GetGlobal())) {}
+      : task_environment_(base::test::TaskEnvironment::TimeSource::MOCK_TIME),
+        local_state_(std::make_unique<ScopedTestingLocalState>(
+            TestingBrowserProcess::GetGlobal())),
+        shared_url_loader_factory_(
+            base::MakeRefCounted<network::WeakWrapperSharedURLLoaderFactory>(
+                &url_loader_factory_)) {}
 
   ~DecentralizedDnsNetworkDelegateHelperTest() override = default;
 
   void SetUp() override {
     feature_list_.InitAndEnableFeature(features::kDecentralizedDns);
     profile_ = std::make_unique<TestingProfile>();
+
+    // Route eth_call requests made by the helper to |url_loader_factory_|.
+    brave_wallet::JsonRpcServiceFactory::GetInstance()->SetTestingFactory(
+        profile_.get(),
+        base::BindRepeating(
+            [](scoped_refptr<network::SharedURLLoaderFactory>
+                   shared_url_loader_factory,
+               content::BrowserContext* context)
+                -> std::unique_ptr<KeyedService> {
+              return std::make_unique<brave_wallet::JsonRpcService>(
+                  shared_url_loader_factory,
+                  user_prefs::UserPrefs::Get(context));
+            },
+            shared_url_loader_factory_));
   }
 
   void TearDown() override {
@@ -48,11 +134,27 @@ class DecentralizedDnsNetworkDelegateHelperTest : public testing::Test {
 
   TestingProfile* profile() { return profile_.get(); }
   PrefService* local_state() { return local_state_->Get(); }
+  network::TestURLLoaderFactory* url_loader_factory() {
+    return &url_loader_factory_;
+  }
 
- private:
+  // Responds to the only pending eth_call request with |content|.
+  void RespondToPendingRequest(const std::string& content) {
+    ASSERT_EQ(1, url_loader_factory_.NumPending());
+    const GURL url = (*url_loader_factory_.pending_requests())[0].request.url;
+    url_loader_factory_.AddResponse(url.spec(), content);
+    task_environment_.RunUntilIdle();
+    url_loader_factory_.ClearResponses();
+  }
+
+ protected:
   content::BrowserTaskEnvironment task_environment_;
-  std::unique_ptr<TestingProfile> profile_;
+
+ private:
   std::unique_ptr<ScopedTestingLocalState> local_state_;
+  std::unique_ptr<TestingProfile> profile_;
+  network::TestURLLoaderFactory url_loader_factory_;
+  scoped_refptr<network::SharedURLLoaderFactory> shared_url_loader_factory_;
   base::test::ScopedFeatureList feature_list_;
 };
 
@@ -112,6 +214,129 @@ TEST_F(DecentralizedDnsNetworkDelegateHelperTest,
   EXPECT_TRUE(brave_request_info->new_url_spec.empty());
 }
 
+TEST_F(DecentralizedDnsNetworkDelegateHelperTest,
+       DecentralizedDnsPreRedirectWorkWithCachedResolution) {
+  local_state()->SetInteger(kUnstoppableDomainsResolveMethod,
+                            static_cast<int>(ResolveMethodTypes::ETHEREUM));
+
+  GURL url("http://brave.crypto");
+  auto brave_request_info = std::make_shared<brave::BraveRequestInfo>(url);
+  brave_request_info->browser_context = profile();
+
+  ResolutionCache::GetForBrowserContext(profile())->OnResolved(
+      "brave.crypto", /* success */ true,
+      "ipfs://QmWrdNJWMbvRxxzLhojVKaBDswS4KNVM7LvjsN7QbDrvka");
+
+  int rc = OnBeforeURLRequest_DecentralizedDnsPreRedirectWork(
+      ResponseCallback(), brave_request_info);
+  EXPECT_EQ(rc, net::OK);
+  EXPECT_EQ(brave_request_info->new_url_spec,
+            "ipfs://QmWrdNJWMbvRxxzLhojVKaBDswS4KNVM7LvjsN7QbDrvka");
+
+  // Hosts without usable records are cached too.
+  ResolutionCache::GetForBrowserContext(profile())->OnResolved(
+      "test.crypto", /* success */ true, "");
+  brave_request_info = std::make_shared<brave::BraveRequestInfo>(
+      GURL("http://test.crypto"));
+  brave_request_info->browser_context = profile();
+  rc = OnBeforeURLRequest_DecentralizedDnsPreRedirectWork(ResponseCallback(),
+                                                          brave_request_info);
+  EXPECT_EQ(rc, net::OK);
+  EXPECT_TRUE(brave_request_info->new_url_spec.empty());
+}
+
+TEST_F(DecentralizedDnsNetworkDelegateHelperTest,
+       ConcurrentLookupsIssueSingleRequest) {
+  local_state()->SetInteger(kUnstoppableDomainsResolveMethod,
+                            static_cast<int>(ResolveMethodTypes::ETHEREUM));
+
+  constexpr size_t kRequestCount = 5;
+  std::vector<std::shared_ptr<brave::BraveRequestInfo>> request_infos;
+  size_t completed_count = 0;
+  for (size_t i = 0; i < kRequestCount; ++i) {
+    auto brave_request_info = std::make_shared<brave::BraveRequestInfo>(
+        GURL("http://brave.crypto/" + std::to_string(i)));
+    brave_request_info->browser_context = profile();
+    request_infos.push_back(brave_request_info);
+
+    const int rc = OnBeforeURLRequest_DecentralizedDnsPreRedirectWork(
+        base::BindLambdaForTesting([&]() { ++completed_count; }),
+        brave_request_info);
+    EXPECT_EQ(rc, net::ERR_IO_PENDING);
+  }
+
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(1, url_loader_factory()->NumPending());
+  EXPECT_EQ(0u, completed_count);
+
+  RespondToPendingRequest(kIpfsHashResponse);
+  EXPECT_EQ(kRequestCount, completed_count);
+  for (const auto& brave_request_info : request_infos)
+    EXPECT_EQ(kIpfsURLSpec, brave_request_info->new_url_spec);
+
+  // Later lookups are served from the cache without a request.
+  auto brave_request_info =
+      std::make_shared<brave::BraveRequestInfo>(GURL("http://brave.crypto"));
+  brave_request_info->browser_context = profile();
+  const int rc = OnBeforeURLRequest_DecentralizedDnsPreRedirectWork(
+      ResponseCallback(), brave_request_info);
+  EXPECT_EQ(rc, net::OK);
+  EXPECT_EQ(kIpfsURLSpec, brave_request_info->new_url_spec);
+  EXPECT_EQ(0, url_loader_factory()->NumPending());
+}
+
+TEST_F(DecentralizedDnsNetworkDelegateHelperTest,
+       StaleLookupIsRefreshedInBackground) {
+  local_state()->SetInteger(kUnstoppableDomainsResolveMethod,
+                            static_cast<int>(ResolveMethodTypes::ETHEREUM));
+
+  const GURL url("http://brave.crypto");
+  auto brave_request_info = std::make_shared<brave::BraveRequestInfo>(url);
+  brave_request_info->browser_context = profile();
+  int rc = OnBeforeURLRequest_DecentralizedDnsPreRedirectWork(
+      ResponseCallback(), brave_request_info);
+  EXPECT_EQ(rc, net::ERR_IO_PENDING);
+  RespondToPendingRequest(kIpfsHashResponse);
+  EXPECT_EQ(kIpfsURLSpec, brave_request_info->new_url_spec);
+
+  task_environment_.FastForwardBy(base::Minutes(10));
+
+  // The stale resolution is used without waiting for the refresh.
+  bool callback_called = false;
+  brave_request_info = std::make_shared<brave::BraveRequestInfo>(url);
+  brave_request_info->browser_context = profile();
+  rc = OnBeforeURLRequest_DecentralizedDnsPreRedirectWork(
+      base::BindLambdaForTesting([&]() { callback_called = true; }),
+      brave_request_info);
+  EXPECT_EQ(rc, net::OK);
+  EXPECT_EQ(kIpfsURLSpec, brave_request_info->new_url_spec);
+
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(1, url_loader_factory()->NumPending());
+
+  // Lookups while refreshing do not issue further requests.
+  brave_request_info = std::make_shared<brave::BraveRequestInfo>(url);
+  brave_request_info->browser_context = profile();
+  rc = OnBeforeURLRequest_DecentralizedDnsPreRedirectWork(ResponseCallback(),
+                                                          brave_request_info);
+  EXPECT_EQ(rc, net::OK);
+  EXPECT_EQ(kIpfsURLSpec, brave_request_info->new_url_spec);
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(1, url_loader_factory()->NumPending());
+
+  RespondToPendingRequest(kNoRecordsResponse);
+  EXPECT_FALSE(callback_called);
+
+  // The refreshed resolution replaces the stale one.
+  brave_request_info = std::make_shared<brave::BraveRequestInfo>(url);
+  brave_request_info->browser_context = profile();
+  rc = OnBeforeURLRequest_DecentralizedDnsPreRedirectWork(ResponseCallback(),
+                                                          brave_request_info);
+  EXPECT_EQ(rc, net::OK);
+  EXPECT_TRUE(brave_request_info->new_url_spec.empty());
+  EXPECT_EQ(0, url_loader_factory()->NumPending());
+}
+
 TEST_F(DecentralizedDnsNetworkDelegateHelperTest,
        UnstoppableDomainsRedirectWork) {
   GURL url("http://brave.crypto");
@@ -0,0 +1,121 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/url_pattern_host_index.h"
+
+#include <utility>
+
+#include "base/check.h"
+#include "base/strings/string_util.h"
+#include "url/gurl.h"
+
+namespace brave {
+
+URLPatternHostIndex::Entry::Entry(size_t index,
+                                  int id,
+                                  const URLPattern& pattern,
+                                  absl::optional<URLPattern> except,
+                                  bool match_host_only)
+    : index(index),
+      id(id),
+      pattern(pattern),
+      except(std::move(except)),
+      match_host_only(match_host_only) {}
+
+URLPatternHostIndex::Entry::Entry(const Entry&) = default;
+
+URLPatternHostIndex::Entry& URLPatternHostIndex::Entry::operator=(
+    const Entry&) = default;
+
+URLPatternHostIndex::Entry::~Entry() = default;
+
+bool URLPatternHostIndex::Entry::Matches(const GURL& url) const {
+  if (match_host_only)
+    return pattern.MatchesHost(url);
+  return pattern.MatchesURL(url) && !(except && except->MatchesURL(url));
+}
+
+URLPatternHostIndex::URLPatternHostIndex() = default;
+
+URLPatternHostIndex::URLPatternHostIndex(const URLPatternHostIndex&) = default;
+
+URLPatternHostIndex& URLPatternHostIndex::operator=(
+    const URLPatternHostIndex&) = default;
+
+URLPatternHostIndex::URLPatternHostIndex(URLPatternHostIndex&&) = default;
+
+URLPatternHostIndex& URLPatternHostIndex::operator=(URLPatternHostIndex&&) =
+    default;
+
+URLPatternHostIndex::~URLPatternHostIndex() = default;
+
+void URLPatternHostIndex::Add(int id,
+                              const URLPattern& pattern,
+                              absl::optional<URLPattern> except) {
+  AddEntry(id, pattern, std::move(except), false);
+}
+
+void URLPatternHostIndex::AddHost(int id, const URLPattern& pattern) {
+  AddEntry(id, pattern, absl::nullopt, true);
+}
+
+void URLPatternHostIndex::AddEntry(int id,
+                                   const URLPattern& pattern,
+                                   absl::optional<URLPattern> except,
+                                   bool match_host_only) {
+  // Patterns matching all hosts can't be indexed.
+  DCHECK(!pattern.host().empty());
+  HostEntries& entries =
+      pattern.match_subdomains() ? domain_entries_ : host_entries_;
+  entries[pattern.host()].emplace_back(size_++, id, pattern, std::move(except),
+                                       match_host_only);
+}
+
+absl::optional<int> URLPatternHostIndex::FindFirstMatch(const GURL& url) const {
+  if (!url.has_host())
+    return absl::nullopt;
+
+  // Patterns match hosts regardless of a trailing dot.
+  base::StringPiece host = url.host_piece();
+  if (base::EndsWith(host, "."))
+    host.remove_suffix(1);
+
+  const Entry* first_match = nullptr;
+  FindFirstMatch(host_entries_, host, url, &first_match);
+  for (base::StringPiece domain = host; !domain_entries_.empty();) {
+    FindFirstMatch(domain_entries_, domain, url, &first_match);
+    const size_t dot = domain.find('.');
+    if (dot == base::StringPiece::npos)
+      break;
+    domain.remove_prefix(dot + 1);
+  }
+
+  if (!first_match)
+    return absl::nullopt;
+  return first_match->id;
+}
+
+// static
+void URLPatternHostIndex::FindFirstMatch(const HostEntries& host_entries,
+                                         base::StringPiece host,
+                                         const GURL& url,
+                                         const Entry** first_match) {
+  auto it = host_entries.find(host);
+  if (it == host_entries.end())
+    return;
+
+  // Entries of a host are in the order they were added, so only the first
+  // match of each host can be the first match overall.
+  for (const auto& entry : it->second) {
+    if (*first_match && (*first_match)->index < entry.index)
+      return;
+    if (entry.Matches(url)) {
+      *first_match = &entry;
+      return;
+    }
+  }
+}
+
+}  // namespace brave
@@ -0,0 +1,84 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_BROWSER_NET_URL_PATTERN_HOST_INDEX_H_
+#define BRAVE_BROWSER_NET_URL_PATTERN_HOST_INDEX_H_
+
+#include <string>
+#include <vector>
+
+#include "base/containers/flat_map.h"
+#include "base/strings/string_piece.h"
+#include "extensions/common/url_pattern.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+class GURL;
+
+namespace brave {
+
+// Groups URL patterns by the host they match so that a request is only
+// checked against the patterns for its own host, and most requests, which
+// match no pattern, cost a few host lookups. Patterns must have a host, and
+// subdomain wildcards are looked up by each parent domain of the request host.
+class URLPatternHostIndex {
+ public:
+  URLPatternHostIndex();
+  URLPatternHostIndex(const URLPatternHostIndex&);
+  URLPatternHostIndex& operator=(const URLPatternHostIndex&);
+  URLPatternHostIndex(URLPatternHostIndex&&);
+  URLPatternHostIndex& operator=(URLPatternHostIndex&&);
+  ~URLPatternHostIndex();
+
+  // Adds |pattern| for |id|, which matches URLs unless they match |except|.
+  void Add(int id,
+           const URLPattern& pattern,
+           absl::optional<URLPattern> except = absl::nullopt);
+  // Same as Add(), but only the host of URLs is matched against |pattern|.
+  void AddHost(int id, const URLPattern& pattern);
+
+  // Returns the id of the first added pattern matching |url|.
+  absl::optional<int> FindFirstMatch(const GURL& url) const;
+
+ private:
+  struct Entry {
+    Entry(size_t index,
+          int id,
+          const URLPattern& pattern,
+          absl::optional<URLPattern> except,
+          bool match_host_only);
+    Entry(const Entry&);
+    Entry& operator=(const Entry&);
+    ~Entry();
+
+    bool Matches(const GURL& url) const;
+
+    // Order in which the entry was added.
+    size_t index;
+    int id;
+    URLPattern pattern;
+    absl::optional<URLPattern> except;
+    bool match_host_only;
+  };
+  using HostEntries = base::flat_map<std::string, std::vector<Entry>>;
+
+  void AddEntry(int id,
+                const URLPattern& pattern,
+                absl::optional<URLPattern> except,
+                bool match_host_only);
+  static void FindFirstMatch(const HostEntries& host_entries,
+                             base::StringPiece host,
+                             const GURL& url,
+                             const Entry** first_match);
+
+  // Patterns matching exactly their host.
+  HostEntries host_entries_;
+  // Patterns matching their host and all of its subdomains.
+  HostEntries domain_entries_;
+  size_t size_ = 0;
+};
+
+}  // namespace brave
+
+#endif  // BRAVE_BROWSER_NET_URL_PATTERN_HOST_INDEX_H_
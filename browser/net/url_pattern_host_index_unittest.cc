@@ -0,0 +1,62 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/url_pattern_host_index.h"
+
+#include "extensions/common/url_pattern.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace brave {
+
+namespace {
+
+constexpr int kHttpOrHttps = URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS;
+
+}  // namespace
+
+TEST(URLPatternHostIndexTest, MatchHostAndSubdomains) {
+  URLPatternHostIndex index;
+  index.Add(1, URLPattern(kHttpOrHttps, "*://example.com/path/*"));
+  index.Add(2, URLPattern(kHttpOrHttps, "*://*.gvt1.com/*"));
+
+  EXPECT_EQ(1, index.FindFirstMatch(GURL("https://example.com/path/a")));
+  EXPECT_FALSE(index.FindFirstMatch(GURL("https://example.com/other")));
+  EXPECT_FALSE(index.FindFirstMatch(GURL("https://www.example.com/path/a")));
+
+  EXPECT_EQ(2, index.FindFirstMatch(GURL("https://gvt1.com/a")));
+  EXPECT_EQ(2, index.FindFirstMatch(GURL("http://r1---sn.gvt1.com/a")));
+  EXPECT_FALSE(index.FindFirstMatch(GURL("https://notgvt1.com/a")));
+  EXPECT_FALSE(index.FindFirstMatch(GURL("ftp://gvt1.com/a")));
+  EXPECT_FALSE(index.FindFirstMatch(GURL("data:text/plain,gvt1.com")));
+}
+
+TEST(URLPatternHostIndexTest, FirstAddedPatternWins) {
+  URLPatternHostIndex index;
+  index.Add(1, URLPattern(kHttpOrHttps, "*://*.gvt1.com/edgedl/*"));
+  index.Add(2, URLPattern(kHttpOrHttps, "*://r1.gvt1.com/*"));
+  index.Add(3, URLPattern(kHttpOrHttps, "*://*.gvt1.com/*"));
+
+  EXPECT_EQ(1, index.FindFirstMatch(GURL("https://r1.gvt1.com/edgedl/a")));
+  EXPECT_EQ(2, index.FindFirstMatch(GURL("https://r1.gvt1.com/a")));
+  EXPECT_EQ(3, index.FindFirstMatch(GURL("https://r2.gvt1.com/a")));
+}
+
+TEST(URLPatternHostIndexTest, ExceptAndHostOnlyPatterns) {
+  URLPatternHostIndex index;
+  index.Add(1, URLPattern(kHttpOrHttps, "*://dl.google.com/*"),
+            URLPattern(kHttpOrHttps, "*://dl.google.com/*widevine*"));
+  index.AddHost(2, URLPattern(URLPattern::SCHEME_HTTPS,
+                              "https://safebrowsing.googleapis.com/"));
+
+  EXPECT_EQ(1, index.FindFirstMatch(GURL("https://dl.google.com/a")));
+  EXPECT_FALSE(index.FindFirstMatch(GURL("https://dl.google.com/widevine")));
+
+  // Only the host is matched, so any scheme and path match.
+  EXPECT_EQ(2, index.FindFirstMatch(
+                   GURL("http://safebrowsing.googleapis.com/v4/threat")));
+}
+
+}  // namespace brave
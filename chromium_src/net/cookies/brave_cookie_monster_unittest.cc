@@ -0,0 +1,102 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "net/cookies/cookie_monster.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "base/test/task_environment.h"
+#include "base/time/time.h"
+#include "net/cookies/canonical_cookie.h"
+#include "net/cookies/cookie_access_result.h"
+#include "net/cookies/cookie_options.h"
+#include "net/cookies/cookie_partition_key_collection.h"
+#include "net/cookies/cookie_store_test_callbacks.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+#include "url/origin.h"
+
+namespace net {
+
+namespace {
+
+const char kThirdPartyURL[] = "https://thirdparty.com/";
+const char kTopFrameURL[] = "https://firstparty.com/";
+const char kOtherTopFrameURL[] = "https://otherparty.com/";
+
+CookieOptions MakeEphemeralCookieOptions(const GURL& top_frame_url) {
+  CookieOptions options = CookieOptions::MakeAllInclusive();
+  options.set_should_use_ephemeral_storage(true);
+  options.set_top_frame_origin(url::Origin::Create(top_frame_url));
+  return options;
+}
+
+}  // namespace
+
+class BraveCookieMonsterTest : public testing::Test {
+ public:
+  BraveCookieMonsterTest()
+      : cookie_monster_(std::make_unique<CookieMonster>(
+            nullptr /* store */,
+            nullptr /* net_log */,
+            /*first_party_sets_enabled=*/false)) {}
+
+  CookieList GetCookies(const GURL& url, const CookieOptions& options) {
+    GetCookieListCallback callback;
+    cookie_monster_->GetCookieListWithOptionsAsync(
+        url, options, CookiePartitionKeyCollection(), callback.MakeCallback());
+    callback.WaitUntilDone();
+    return callback.cookies();
+  }
+
+  bool SetCookie(const GURL& url,
+                 const std::string& cookie_line,
+                 const CookieOptions& options) {
+    std::unique_ptr<CanonicalCookie> cookie = CanonicalCookie::Create(
+        url, cookie_line, base::Time::Now(), /*server_time=*/absl::nullopt,
+        /*cookie_partition_key=*/absl::nullopt);
+    EXPECT_TRUE(cookie);
+
+    ResultSavingCookieCallback<CookieAccessResult> callback;
+    cookie_monster_->SetCanonicalCookieAsync(std::move(cookie), url, options,
+                                             callback.MakeCallback());
+    callback.WaitUntilDone();
+    return callback.result().status.IsInclude();
+  }
+
+ protected:
+  base::test::TaskEnvironment task_environment_;
+  std::unique_ptr<CookieMonster> cookie_monster_;
+};
+
+TEST_F(BraveCookieMonsterTest, EphemeralStoreIsCreatedOnSet) {
+  const GURL url(kThirdPartyURL);
+  const CookieOptions options = MakeEphemeralCookieOptions(GURL(kTopFrameURL));
+
+  // Reading cookies for a top frame without ephemeral cookies doesn't create
+  // a store for it.
+  EXPECT_TRUE(GetCookies(url, options).empty());
+  EXPECT_EQ(0u, cookie_monster_->GetEphemeralCookieStoreCountForTesting());
+
+  // Setting a cookie does, and the cookie is visible to later reads.
+  EXPECT_TRUE(SetCookie(url, "name=value", options));
+  EXPECT_EQ(1u, cookie_monster_->GetEphemeralCookieStoreCountForTesting());
+
+  const CookieList cookies = GetCookies(url, options);
+  ASSERT_EQ(1u, cookies.size());
+  EXPECT_EQ("name", cookies[0].Name());
+  EXPECT_EQ("value", cookies[0].Value());
+
+  // The cookie is only visible under the top frame it was set for.
+  EXPECT_TRUE(
+      GetCookies(url, MakeEphemeralCookieOptions(GURL(kOtherTopFrameURL)))
+          .empty());
+  EXPECT_TRUE(GetCookies(url, CookieOptions::MakeAllInclusive()).empty());
+  EXPECT_EQ(1u, cookie_monster_->GetEphemeralCookieStoreCountForTesting());
+}
+
+}  // namespace net
@@ -50,10 +50,18 @@ class NET_EXPORT CookieMonster : public ChromiumCookieMonster {
       const CookiePartitionKeyCollection& cookie_partition_key_collection,
       GetCookieListCallback callback) override;
 
+  size_t GetEphemeralCookieStoreCountForTesting() const {
+    return ephemeral_cookie_stores_.size();
+  }
+
  private:
   NetLogWithSource net_log_;
   std::map<std::string, std::unique_ptr<ChromiumCookieMonster>>
       ephemeral_cookie_stores_;
+  // Returns nullptr if no store was created yet for the ephemeral storage
+  // domain of |top_frame_url|.
+  ChromiumCookieMonster* GetEphemeralCookieStoreForTopFrameURL(
+      const GURL& top_frame_url);
   ChromiumCookieMonster* GetOrCreateEphemeralCookieStoreForTopFrameURL(
       const GURL& top_frame_url);
 };
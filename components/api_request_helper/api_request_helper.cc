@@ -7,6 +7,9 @@
 
 #include <utility>
 
+#include "base/json/json_reader.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/task/thread_pool.h"
 #include "net/base/load_flags.h"
 #include "services/network/public/cpp/resource_request.h"
 #include "services/network/public/cpp/shared_url_loader_factory.h"
@@ -17,6 +20,35 @@ namespace api_request_helper {
 
 const unsigned int kRetriesCountOnNetworkChange = 1;
 
+namespace {
+
+base::Value ParseJSON(const std::string& json) {
+  absl::optional<base::Value> value = base::JSONReader::Read(json);
+  return value ? std::move(*value) : base::Value();
+}
+
+std::string GetCoalesceKey(
+    const GURL& url,
+    bool auto_retry_on_network_change,
+    bool use_http_cache,
+    const base::flat_map<std::string, std::string>& headers,
+    size_t max_body_size) {
+  std::string key = url.spec();
+  key += '\n';
+  key += auto_retry_on_network_change ? '1' : '0';
+  key += use_http_cache ? '1' : '0';
+  key += base::NumberToString(max_body_size);
+  for (const auto& entry : headers) {
+    key += '\n';
+    key += entry.first;
+    key += ':';
+    key += entry.second;
+  }
+  return key;
+}
+
+}  // namespace
+
 APIRequestHelper::APIRequestHelper(
     net::NetworkTrafficAnnotationTag annotation_tag,
     scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory)
@@ -34,10 +66,58 @@ void APIRequestHelper::Request(
     ResultCallback callback,
     const base::flat_map<std::string, std::string>& headers /* ={} */,
     size_t max_body_size /* =-1 */) {
+  StartRequest(method, url, payload, payload_content_type,
+               auto_retry_on_network_change,
+               net::LOAD_BYPASS_CACHE | net::LOAD_DISABLE_CACHE |
+                   net::LOAD_DO_NOT_SAVE_COOKIES,
+               std::move(callback), headers, max_body_size);
+}
+
+void APIRequestHelper::RequestJSON(
+    const std::string& method,
+    const GURL& url,
+    const std::string& payload,
+    const std::string& payload_content_type,
+    bool auto_retry_on_network_change,
+    bool use_http_cache,
+    JSONResultCallback callback,
+    const base::flat_map<std::string, std::string>& headers /* ={} */,
+    size_t max_body_size /* =-1 */) {
+  std::string coalesce_key;
+  if (method == "GET" && payload.empty()) {
+    coalesce_key = GetCoalesceKey(url, auto_retry_on_network_change,
+                                  use_http_cache, headers, max_body_size);
+    auto& callbacks = pending_json_requests_[coalesce_key];
+    callbacks.push_back(std::move(callback));
+    if (callbacks.size() > 1)
+      return;
+  }
+
+  int load_flags = net::LOAD_DO_NOT_SAVE_COOKIES;
+  if (!use_http_cache)
+    load_flags |= net::LOAD_BYPASS_CACHE | net::LOAD_DISABLE_CACHE;
+
+  StartRequest(method, url, payload, payload_content_type,
+               auto_retry_on_network_change, load_flags,
+               base::BindOnce(&APIRequestHelper::OnJSONResponse,
+                              base::Unretained(this), coalesce_key,
+                              std::move(callback)),
+               headers, max_body_size);
+}
+
+void APIRequestHelper::StartRequest(
+    const std::string& method,
+    const GURL& url,
+    const std::string& payload,
+    const std::string& payload_content_type,
+    bool auto_retry_on_network_change,
+    int load_flags,
+    ResultCallback callback,
+    const base::flat_map<std::string, std::string>& headers,
+    size_t max_body_size) {
   auto request = std::make_unique<network::ResourceRequest>();
   request->url = url;
-  request->load_flags = net::LOAD_BYPASS_CACHE | net::LOAD_DISABLE_CACHE |
-                        net::LOAD_DO_NOT_SAVE_COOKIES;
+  request->load_flags = load_flags;
   request->credentials_mode = network::mojom::CredentialsMode::kOmit;
   request->method = method;
 
@@ -97,4 +177,38 @@ void APIRequestHelper::OnResponse(
                           headers);
 }
 
+void APIRequestHelper::OnJSONResponse(
+    const std::string& coalesce_key,
+    JSONResultCallback callback,
+    const int response_code,
+    const std::string& response_body,
+    const base::flat_map<std::string, std::string>& headers) {
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::TaskPriority::USER_VISIBLE},
+      base::BindOnce(&ParseJSON, response_body),
+      base::BindOnce(&APIRequestHelper::OnJSONParsed,
+                     weak_ptr_factory_.GetWeakPtr(), coalesce_key,
+                     std::move(callback), response_code, headers));
+}
+
+void APIRequestHelper::OnJSONParsed(
+    const std::string& coalesce_key,
+    JSONResultCallback callback,
+    const int response_code,
+    const base::flat_map<std::string, std::string>& headers,
+    base::Value value) {
+  if (coalesce_key.empty()) {
+    std::move(callback).Run(response_code, std::move(value), headers);
+    return;
+  }
+
+  auto iter = pending_json_requests_.find(coalesce_key);
+  DCHECK(iter != pending_json_requests_.end());
+  std::vector<JSONResultCallback> callbacks = std::move(iter->second);
+  pending_json_requests_.erase(iter);
+  for (size_t i = 0; i + 1 < callbacks.size(); ++i)
+    std::move(callbacks[i]).Run(response_code, value.Clone(), headers);
+  std::move(callbacks.back()).Run(response_code, std::move(value), headers);
+}
+
 }  // namespace api_request_helper
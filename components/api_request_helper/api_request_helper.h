@@ -7,11 +7,15 @@
 #define BRAVE_COMPONENTS_API_REQUEST_HELPER_API_REQUEST_HELPER_H_
 
 #include <list>
+#include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "base/callback.h"
 #include "base/containers/flat_map.h"
+#include "base/memory/weak_ptr.h"
+#include "base/values.h"
 #include "net/traffic_annotation/network_traffic_annotation.h"
 #include "url/gurl.h"
 
@@ -43,18 +47,61 @@ class APIRequestHelper {
                const base::flat_map<std::string, std::string>& headers = {},
                size_t max_body_size = -1u);
 
+  using JSONResultCallback =
+      base::OnceCallback<void(const int,
+                              base::Value,
+                              const base::flat_map<std::string, std::string>&)>;
+  // Like Request, but parses the response body as JSON on the thread pool and
+  // replies with the parsed value, or a NONE value if the body isn't valid
+  // JSON. When |use_http_cache| is true the response may be served from the
+  // HTTP cache and stale entries are revalidated with their ETag instead of
+  // being downloaded again. Identical GET requests that are still in flight
+  // share a single network request.
+  void RequestJSON(const std::string& method,
+                   const GURL& url,
+                   const std::string& payload,
+                   const std::string& payload_content_type,
+                   bool auto_retry_on_network_change,
+                   bool use_http_cache,
+                   JSONResultCallback callback,
+                   const base::flat_map<std::string, std::string>& headers = {},
+                   size_t max_body_size = -1u);
+
  private:
   APIRequestHelper(const APIRequestHelper&) = delete;
   APIRequestHelper& operator=(const APIRequestHelper&) = delete;
   using SimpleURLLoaderList =
       std::list<std::unique_ptr<network::SimpleURLLoader>>;
+  void StartRequest(const std::string& method,
+                    const GURL& url,
+                    const std::string& payload,
+                    const std::string& payload_content_type,
+                    bool auto_retry_on_network_change,
+                    int load_flags,
+                    ResultCallback callback,
+                    const base::flat_map<std::string, std::string>& headers,
+                    size_t max_body_size);
   void OnResponse(SimpleURLLoaderList::iterator iter,
                   ResultCallback callback,
                   const std::unique_ptr<std::string> response_body);
+  void OnJSONResponse(const std::string& coalesce_key,
+                      JSONResultCallback callback,
+                      const int response_code,
+                      const std::string& response_body,
+                      const base::flat_map<std::string, std::string>& headers);
+  void OnJSONParsed(const std::string& coalesce_key,
+                    JSONResultCallback callback,
+                    const int response_code,
+                    const base::flat_map<std::string, std::string>& headers,
+                    base::Value value);
 
   net::NetworkTrafficAnnotationTag annotation_tag_;
   SimpleURLLoaderList url_loaders_;
   scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
+  // Callbacks waiting for an in-flight JSON GET request, keyed by everything
+  // that identifies the request.
+  std::map<std::string, std::vector<JSONResultCallback>> pending_json_requests_;
+  base::WeakPtrFactory<APIRequestHelper> weak_ptr_factory_{this};
 };
 
 }  // namespace api_request_helper
@@ -0,0 +1,129 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/api_request_helper/api_request_helper.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/bind.h"
+#include "base/test/bind.h"
+#include "base/test/task_environment.h"
+#include "net/base/load_flags.h"
+#include "net/traffic_annotation/network_traffic_annotation_test_helper.h"
+#include "services/network/public/cpp/weak_wrapper_shared_url_loader_factory.h"
+#include "services/network/test/test_url_loader_factory.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace api_request_helper {
+
+namespace {
+
+constexpr char kTestURL[] = "https://example.com/api";
+
+}  // namespace
+
+class APIRequestHelperTest : public testing::Test {
+ public:
+  APIRequestHelperTest()
+      : shared_url_loader_factory_(
+            base::MakeRefCounted<network::WeakWrapperSharedURLLoaderFactory>(
+                &url_loader_factory_)),
+        api_request_helper_(TRAFFIC_ANNOTATION_FOR_TESTS,
+                            shared_url_loader_factory_) {}
+
+  void RequestJSON(const std::string& method, bool use_http_cache) {
+    api_request_helper_.RequestJSON(
+        method, GURL(kTestURL), "", "", true, use_http_cache,
+        base::BindOnce(
+            [](std::vector<base::Value>* results, const int response_code,
+               base::Value value,
+               const base::flat_map<std::string, std::string>& headers) {
+              EXPECT_EQ(200, response_code);
+              results->push_back(std::move(value));
+            },
+            &results_));
+  }
+
+  base::test::TaskEnvironment task_environment_;
+  network::TestURLLoaderFactory url_loader_factory_;
+  scoped_refptr<network::SharedURLLoaderFactory> shared_url_loader_factory_;
+  APIRequestHelper api_request_helper_;
+  std::vector<base::Value> results_;
+};
+
+TEST_F(APIRequestHelperTest, ParseJSONResponse) {
+  url_loader_factory_.AddResponse(kTestURL, R"({"result": "0x1"})");
+  RequestJSON("GET", false);
+  task_environment_.RunUntilIdle();
+
+  ASSERT_EQ(1u, results_.size());
+  ASSERT_TRUE(results_[0].is_dict());
+  const std::string* result = results_[0].FindStringKey("result");
+  ASSERT_TRUE(result);
+  EXPECT_EQ("0x1", *result);
+}
+
+TEST_F(APIRequestHelperTest, InvalidJSONResponse) {
+  url_loader_factory_.AddResponse(kTestURL, "not json");
+  RequestJSON("GET", false);
+  task_environment_.RunUntilIdle();
+
+  ASSERT_EQ(1u, results_.size());
+  EXPECT_TRUE(results_[0].is_none());
+}
+
+TEST_F(APIRequestHelperTest, CoalesceInFlightGETRequests) {
+  RequestJSON("GET", true);
+  RequestJSON("GET", true);
+  EXPECT_EQ(1, url_loader_factory_.NumPending());
+
+  url_loader_factory_.AddResponse(kTestURL, "[1, 2]");
+  task_environment_.RunUntilIdle();
+
+  ASSERT_EQ(2u, results_.size());
+  EXPECT_EQ(results_[0], results_[1]);
+  ASSERT_TRUE(results_[0].is_list());
+  EXPECT_EQ(2u, results_[0].GetList().size());
+
+  // Requests made after the response arrived go to the network again.
+  RequestJSON("GET", true);
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(3u, results_.size());
+}
+
+TEST_F(APIRequestHelperTest, DoNotCoalescePOSTRequests) {
+  RequestJSON("POST", false);
+  RequestJSON("POST", false);
+  EXPECT_EQ(2, url_loader_factory_.NumPending());
+
+  url_loader_factory_.AddResponse(kTestURL, "{}");
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(2u, results_.size());
+}
+
+TEST_F(APIRequestHelperTest, HTTPCacheLoadFlags) {
+  std::vector<int> load_flags;
+  url_loader_factory_.SetInterceptor(
+      base::BindLambdaForTesting([&](const network::ResourceRequest& request) {
+        load_flags.push_back(request.load_flags);
+      }));
+  url_loader_factory_.AddResponse(kTestURL, "{}");
+
+  RequestJSON("GET", true);
+  task_environment_.RunUntilIdle();
+  RequestJSON("GET", false);
+  task_environment_.RunUntilIdle();
+
+  ASSERT_EQ(2u, load_flags.size());
+  EXPECT_FALSE(load_flags[0] & net::LOAD_BYPASS_CACHE);
+  EXPECT_FALSE(load_flags[0] & net::LOAD_DISABLE_CACHE);
+  EXPECT_TRUE(load_flags[1] & net::LOAD_BYPASS_CACHE);
+  EXPECT_TRUE(load_flags[1] & net::LOAD_DISABLE_CACHE);
+  EXPECT_EQ(2u, results_.size());
+}
+
+}  // namespace api_request_helper
@@ -79,16 +79,32 @@ bool AdNotificationTimingDataStore::Init(int task_id,
 
 bool AdNotificationTimingDataStore::AddLog(
     const AdNotificationTimingTaskLog& log) {
+  return AddLogs({log});
+}
+
+bool AdNotificationTimingDataStore::AddLogs(
+    const std::vector<AdNotificationTimingTaskLog>& logs) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
-  sql::Statement s(db_.GetUniqueStatement(
+  sql::Transaction transaction(&db_);
+  if (!transaction.Begin())
+    return false;
+
+  sql::Statement s(db_.GetCachedStatement(
+      SQL_FROM_HERE,
       base::StringPrintf(
           "INSERT INTO %s (time, locale, number_of_tabs, label, creation_date) "
           "VALUES (?,?,?,?,?)",
           task_name_.c_str())
           .c_str()));
-  BindSampleLogToStatement(log, &s);
-  return s.Run();
+  for (const auto& log : logs) {
+    BindSampleLogToStatement(log, &s);
+    if (!s.Run())
+      return false;
+    s.Reset(/* clear_bound_vars */ true);
+  }
+
+  return transaction.Commit();
 }
 
 AdNotificationTimingDataStore::IdToAdNotificationTimingTaskLogMap
@@ -97,26 +113,38 @@ AdNotificationTimingDataStore::LoadLogs() {
 
   AdNotificationTimingDataStore::IdToAdNotificationTimingTaskLogMap
       notification_timing_logs;
-  sql::Statement s(db_.GetUniqueStatement(
+  // Logs are visited in id order, so each one goes at the end of the map.
+  ForEachLog(base::BindRepeating(
+      [](IdToAdNotificationTimingTaskLogMap* notification_timing_logs,
+         const AdNotificationTimingTaskLog& log) {
+        notification_timing_logs->emplace_hint(notification_timing_logs->end(),
+                                               log.id, log);
+      },
+      &notification_timing_logs));
+
+  return notification_timing_logs;
+}
+
+void AdNotificationTimingDataStore::ForEachLog(const LogCallback& callback) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  sql::Statement s(db_.GetCachedStatement(
+      SQL_FROM_HERE,
       base::StringPrintf("SELECT id, time, locale, number_of_tabs, label, "
-                         "creation_date FROM %s",
+                         "creation_date FROM %s ORDER BY id",
                          task_name_.c_str())
           .c_str()));
 
-  notification_timing_logs.clear();
   while (s.Step()) {
-    AdNotificationTimingTaskLog ntl(
+    const AdNotificationTimingTaskLog ntl(
         s.ColumnInt(0),                                    // id
         base::Time::FromInternalValue(s.ColumnInt64(1)),   // time
         s.ColumnString(2),                                 // locale
         s.ColumnInt(3),                                    // number_of_tabs
         s.ColumnBool(4),                                   // label
         base::Time::FromInternalValue(s.ColumnInt64(5)));  // creation_date
-
-    notification_timing_logs.insert(std::make_pair(s.ColumnInt(0), ntl));
+    callback.Run(ntl);
   }
-
-  return notification_timing_logs;
 }
 
 AdNotificationTimingDataStore::~AdNotificationTimingDataStore() {}
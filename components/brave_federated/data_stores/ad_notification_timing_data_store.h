@@ -8,7 +8,9 @@
 
 #include <map>
 #include <string>
+#include <vector>
 
+#include "base/callback.h"
 #include "base/files/file_path.h"
 #include "base/sequence_checker.h"
 #include "base/time/time.h"
@@ -57,6 +59,8 @@ class AdNotificationTimingDataStore final : public DataStore {
 
   typedef std::map<int, AdNotificationTimingTaskLog>
       IdToAdNotificationTimingTaskLogMap;
+  using LogCallback =
+      base::RepeatingCallback<void(const AdNotificationTimingTaskLog& log)>;
 
   bool Init(int task_id,
             const std::string& task_name,
@@ -67,7 +71,13 @@ class AdNotificationTimingDataStore final : public DataStore {
   using DataStore::DeleteLogs;
 
   bool AddLog(const AdNotificationTimingTaskLog& log);
+  // Adds |logs| in a single transaction. Callers collecting several logs
+  // should buffer them and add them together.
+  bool AddLogs(const std::vector<AdNotificationTimingTaskLog>& logs);
   IdToAdNotificationTimingTaskLogMap LoadLogs();
+  // Runs |callback| for each log in insertion order without loading all of
+  // them in memory first.
+  void ForEachLog(const LogCallback& callback);
   bool EnsureTable() override;
 
  private:
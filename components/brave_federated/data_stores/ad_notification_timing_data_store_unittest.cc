@@ -6,9 +6,11 @@
 #include "brave/components/brave_federated/data_stores/ad_notification_timing_data_store.h"
 
 #include <string>
+#include <vector>
 
 #include "base/files/scoped_temp_dir.h"
 #include "base/path_service.h"
+#include "base/test/bind.h"
 #include "base/time/time.h"
 #include "sql/statement.h"
 #include "sql/test/scoped_error_expecter.h"
@@ -137,4 +139,45 @@ TEST_F(AdNotificationTimingDataStoreTest, LoadLogs) {
   }
 }
 
+TEST_F(AdNotificationTimingDataStoreTest, AddLogs) {
+  ClearDB();
+  std::vector<AdNotificationTimingTaskLog> logs;
+  for (size_t i = 0; i < base::size(ad_notification_task_log_test_db); ++i) {
+    logs.push_back(AdNotificationTimingTaskLogFromTestInfo(
+        ad_notification_task_log_test_db[i]));
+  }
+  EXPECT_TRUE(ad_notification_data_store_->AddLogs(logs));
+  EXPECT_EQ(base::size(ad_notification_task_log_test_db), CountRecords());
+
+  std::vector<std::string> locales;
+  ad_notification_data_store_->ForEachLog(base::BindLambdaForTesting(
+      [&](const AdNotificationTimingTaskLog& log) {
+        locales.push_back(log.locale);
+      }));
+  EXPECT_EQ(std::vector<std::string>({"US", "US", "GB", "IT"}), locales);
+}
+
+TEST_F(AdNotificationTimingDataStoreTest, EnforceRetentionPolicy) {
+  base::FilePath db_path(
+      temp_dir_.GetPath().Append(FILE_PATH_LITERAL("retention_test")));
+  AdNotificationTimingDataStore data_store(db_path);
+  ASSERT_TRUE(
+      data_store.Init(0, "ad_notification_timing_federated_task", 2, 30));
+
+  std::vector<AdNotificationTimingTaskLog> logs;
+  for (size_t i = 0; i < base::size(ad_notification_task_log_test_db); ++i) {
+    logs.push_back(AdNotificationTimingTaskLogFromTestInfo(
+        ad_notification_task_log_test_db[i]));
+  }
+  EXPECT_TRUE(data_store.AddLogs(logs));
+
+  data_store.EnforceRetentionPolicy();
+
+  // Only the most recent logs are kept.
+  auto ad_notification_timing_logs = data_store.LoadLogs();
+  ASSERT_EQ(2U, ad_notification_timing_logs.size());
+  EXPECT_EQ("GB", ad_notification_timing_logs.begin()->second.locale);
+  EXPECT_EQ("IT", ad_notification_timing_logs.rbegin()->second.locale);
+}
+
 }  // namespace brave_federated
@@ -70,7 +70,8 @@ bool DataStore::Init(int task_id,
       base::BindRepeating(&DatabaseErrorCallback, &db_, database_path_));
 
   // Attach the database to our index file.
-  return db_.Open(database_path_) && EnsureTable();
+  return db_.Open(database_path_) && EnsureTable() &&
+         EnsureCreationDateIndex();
 }
 
 DataStore::~DataStore() {}
@@ -89,20 +90,49 @@ bool DataStore::DeleteLogs() {
 void DataStore::EnforceRetentionPolicy() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
-  sql::Statement s(db_.GetUniqueStatement(
-      base::StringPrintf(" DELETE FROM %s WHERE creation_date < ? OR id NOT IN "
-                         "(SELECT id FROM %s ORDER BY id DESC LIMIT ?)",
-                         task_name_.c_str(), task_name_.c_str())
+  sql::Transaction transaction(&db_);
+  if (!transaction.Begin())
+    return;
+
+  // Expired logs are found through the creation date index. Statements are
+  // cached per call site, which is fine as |task_name_| never changes for a
+  // given database.
+  sql::Statement delete_expired_logs(db_.GetCachedStatement(
+      SQL_FROM_HERE,
+      base::StringPrintf("DELETE FROM %s WHERE creation_date < ?",
+                         task_name_.c_str())
           .c_str()));
   base::Time expiration_threshold =
       base::Time::Now() - base::Seconds(max_retention_days_ * 24 * 60 * 60);
-  s.BindInt64(0, expiration_threshold.ToInternalValue());
-  s.BindInt(1, max_number_of_records_);
-  s.Run();
+  delete_expired_logs.BindInt64(0, expiration_threshold.ToInternalValue());
+  if (!delete_expired_logs.Run())
+    return;
+
+  // Ids are assigned in insertion order, so logs over the limit are a range
+  // of the primary key ending at the oldest log to keep.
+  sql::Statement delete_oldest_logs(db_.GetCachedStatement(
+      SQL_FROM_HERE,
+      base::StringPrintf("DELETE FROM %s WHERE id <= (SELECT id FROM %s "
+                         "ORDER BY id DESC LIMIT 1 OFFSET ?)",
+                         task_name_.c_str(), task_name_.c_str())
+          .c_str()));
+  delete_oldest_logs.BindInt(0, max_number_of_records_);
+  if (!delete_oldest_logs.Run())
+    return;
+
+  transaction.Commit();
 }
 
 bool DataStore::EnsureTable() {
   return false;
 }
 
+bool DataStore::EnsureCreationDateIndex() {
+  return db_.Execute(
+      base::StringPrintf("CREATE INDEX IF NOT EXISTS %s_creation_date_index "
+                         "ON %s (creation_date)",
+                         task_name_.c_str(), task_name_.c_str())
+          .c_str());
+}
+
 }  // namespace brave_federated
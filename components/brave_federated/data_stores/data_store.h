@@ -42,6 +42,7 @@ class DataStore {
 
  private:
   virtual bool EnsureTable();
+  bool EnsureCreationDateIndex();
 
   SEQUENCE_CHECKER(sequence_checker_);
 };
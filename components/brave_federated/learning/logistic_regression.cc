@@ -0,0 +1,133 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_federated/learning/logistic_regression.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include "base/check_op.h"
+#include "base/rand_util.h"
+#include "brave/components/brave_federated/learning/training_data.h"
+
+namespace brave_federated {
+
+namespace {
+
+constexpr float kMinProbability = 1e-7f;
+
+// The kernels below work on contiguous float arrays. Dot() keeps four partial
+// sums so that the compiler can vectorize the loop without reordering a single
+// floating point sum, which it isn't allowed to do.
+float Dot(const float* a, const float* b, size_t size) {
+  float sums[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    sums[0] += a[i] * b[i];
+    sums[1] += a[i + 1] * b[i + 1];
+    sums[2] += a[i + 2] * b[i + 2];
+    sums[3] += a[i + 3] * b[i + 3];
+  }
+  for (; i < size; ++i)
+    sums[0] += a[i] * b[i];
+  return (sums[0] + sums[1]) + (sums[2] + sums[3]);
+}
+
+// y += alpha * x
+void AddScaled(float alpha, const float* x, float* y, size_t size) {
+  for (size_t i = 0; i < size; ++i)
+    y[i] += alpha * x[i];
+}
+
+float Sigmoid(float z) {
+  return 1.0f / (1.0f + std::exp(-z));
+}
+
+float LogLoss(float prediction, float label) {
+  prediction = std::clamp(prediction, kMinProbability, 1.0f - kMinProbability);
+  return -(label * std::log(prediction) +
+           (1.0f - label) * std::log(1.0f - prediction));
+}
+
+}  // namespace
+
+LogisticRegression::LogisticRegression(size_t num_features)
+    : weights_(num_features, 0.0f) {}
+
+LogisticRegression::LogisticRegression(const std::vector<float>& parameters) {
+  DCHECK(!parameters.empty());
+  weights_.assign(parameters.begin(), parameters.end() - 1);
+  bias_ = parameters.back();
+}
+
+LogisticRegression::LogisticRegression(const LogisticRegression& other) =
+    default;
+
+LogisticRegression& LogisticRegression::operator=(
+    const LogisticRegression& other) = default;
+
+LogisticRegression::~LogisticRegression() = default;
+
+float LogisticRegression::Train(const TrainingData& data,
+                                const TrainingOptions& options) {
+  DCHECK_EQ(num_features(), data.num_features);
+  DCHECK_GT(options.batch_size, 0u);
+
+  const size_t size = data.size();
+  if (size == 0)
+    return 0.0f;
+
+  std::vector<size_t> order(size);
+  std::iota(order.begin(), order.end(), 0);
+  std::vector<float> gradient(num_features());
+
+  float loss = 0.0f;
+  for (int epoch = 0; epoch < options.epochs; ++epoch) {
+    if (options.shuffle)
+      base::RandomShuffle(order.begin(), order.end());
+
+    loss = 0.0f;
+    for (size_t batch_start = 0; batch_start < size;
+         batch_start += options.batch_size) {
+      const size_t batch_end = std::min(size, batch_start + options.batch_size);
+
+      std::fill(gradient.begin(), gradient.end(), 0.0f);
+      float bias_gradient = 0.0f;
+      for (size_t i = batch_start; i < batch_end; ++i) {
+        const float* features = data.GetFeatures(order[i]);
+        const float label = data.labels[order[i]];
+        const float prediction = Predict(features);
+        loss += LogLoss(prediction, label);
+
+        const float error = prediction - label;
+        AddScaled(error, features, gradient.data(), gradient.size());
+        bias_gradient += error;
+      }
+
+      const float step =
+          options.learning_rate / static_cast<float>(batch_end - batch_start);
+      AddScaled(-step, gradient.data(), weights_.data(), weights_.size());
+      bias_ -= step * bias_gradient;
+    }
+    loss /= static_cast<float>(size);
+  }
+
+  return loss;
+}
+
+float LogisticRegression::Predict(const float* features) const {
+  return Sigmoid(Dot(weights_.data(), features, weights_.size()) + bias_);
+}
+
+std::vector<float> LogisticRegression::GetParameters() const {
+  std::vector<float> parameters;
+  parameters.reserve(weights_.size() + 1);
+  parameters.insert(parameters.end(), weights_.begin(), weights_.end());
+  parameters.push_back(bias_);
+  return parameters;
+}
+
+}  // namespace brave_federated
@@ -0,0 +1,59 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_FEDERATED_LEARNING_LOGISTIC_REGRESSION_H_
+#define BRAVE_COMPONENTS_BRAVE_FEDERATED_LEARNING_LOGISTIC_REGRESSION_H_
+
+#include <stddef.h>
+
+#include <vector>
+
+namespace brave_federated {
+
+struct TrainingData;
+
+struct TrainingOptions {
+  int epochs = 1;
+  size_t batch_size = 32;
+  float learning_rate = 0.1f;
+  // Instances are shuffled every epoch unless training has to be
+  // reproducible, e.g. in tests, in which case they are visited in order.
+  bool shuffle = true;
+};
+
+// Binary logistic regression trained locally with mini-batch stochastic
+// gradient descent.
+class LogisticRegression {
+ public:
+  // Starts from all-zero weights and bias.
+  explicit LogisticRegression(size_t num_features);
+  // Starts from a model received from the server. |parameters| are the
+  // weights followed by the bias, as returned by GetParameters().
+  explicit LogisticRegression(const std::vector<float>& parameters);
+  LogisticRegression(const LogisticRegression& other);
+  LogisticRegression& operator=(const LogisticRegression& other);
+  ~LogisticRegression();
+
+  // Returns the mean log loss over the instances of the last epoch.
+  float Train(const TrainingData& data, const TrainingOptions& options);
+
+  // Returns the probability of a positive label for |features|, which must
+  // hold num_features() values.
+  float Predict(const float* features) const;
+
+  std::vector<float> GetParameters() const;
+
+  size_t num_features() const { return weights_.size(); }
+  const std::vector<float>& weights() const { return weights_; }
+  float bias() const { return bias_; }
+
+ private:
+  std::vector<float> weights_;
+  float bias_ = 0.0f;
+};
+
+}  // namespace brave_federated
+
+#endif  // BRAVE_COMPONENTS_BRAVE_FEDERATED_LEARNING_LOGISTIC_REGRESSION_H_
@@ -0,0 +1,105 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_federated/learning/logistic_regression.h"
+
+#include <vector>
+
+#include "base/files/scoped_temp_dir.h"
+#include "base/time/time.h"
+#include "brave/components/brave_federated/data_stores/ad_notification_timing_data_store.h"
+#include "brave/components/brave_federated/learning/training_data.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=LogisticRegressionTest*
+
+namespace brave_federated {
+
+namespace {
+
+// Positive when the first feature is larger than the second.
+TrainingData GetSeparableTrainingData() {
+  TrainingData data(2);
+  for (int i = 0; i < 100; ++i) {
+    const float x = static_cast<float>(i % 10) / 10.0f;
+    const float y = static_cast<float>(i / 10) / 10.0f;
+    if (x != y)
+      data.AddInstance({x, y}, x > y ? 1.0f : 0.0f);
+  }
+  return data;
+}
+
+TrainingOptions GetDeterministicTrainingOptions() {
+  TrainingOptions options;
+  options.epochs = 50;
+  options.batch_size = 8;
+  options.learning_rate = 1.0f;
+  options.shuffle = false;
+  return options;
+}
+
+}  // namespace
+
+TEST(LogisticRegressionTest, TrainOnSeparableData) {
+  const TrainingData data = GetSeparableTrainingData();
+  LogisticRegression model(data.num_features);
+
+  TrainingOptions options = GetDeterministicTrainingOptions();
+  options.epochs = 1;
+  const float first_epoch_loss = model.Train(data, options);
+  options.epochs = 50;
+  const float last_epoch_loss = model.Train(data, options);
+  EXPECT_LT(last_epoch_loss, first_epoch_loss);
+
+  const float positive[] = {0.9f, 0.1f};
+  const float negative[] = {0.1f, 0.9f};
+  EXPECT_GT(model.Predict(positive), 0.9f);
+  EXPECT_LT(model.Predict(negative), 0.1f);
+}
+
+TEST(LogisticRegressionTest, DeterministicTraining) {
+  const TrainingData data = GetSeparableTrainingData();
+  LogisticRegression model(data.num_features);
+  LogisticRegression other_model(data.num_features);
+
+  model.Train(data, GetDeterministicTrainingOptions());
+  other_model.Train(data, GetDeterministicTrainingOptions());
+  EXPECT_EQ(model.GetParameters(), other_model.GetParameters());
+}
+
+TEST(LogisticRegressionTest, StartFromParameters) {
+  const std::vector<float> parameters = {0.5f, -0.5f, 0.25f};
+  LogisticRegression model(parameters);
+  EXPECT_EQ(2u, model.num_features());
+  EXPECT_EQ(0.25f, model.bias());
+  EXPECT_EQ(parameters, model.GetParameters());
+}
+
+TEST(LogisticRegressionTest, TrainOnAdNotificationTimingLogs) {
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  AdNotificationTimingDataStore data_store(
+      temp_dir.GetPath().Append(FILE_PATH_LITERAL("ad_notification_test")));
+  ASSERT_TRUE(
+      data_store.Init(0, "ad_notification_timing_federated_task", 50, 30));
+
+  const base::Time now = base::Time::Now();
+  ASSERT_TRUE(data_store.AddLogs({
+      AdNotificationTimingTaskLog(0, now, "US", 1, true, now),
+      AdNotificationTimingTaskLog(0, now, "US", 50, false, now),
+  }));
+
+  const TrainingData data = LoadAdNotificationTimingTrainingData(&data_store);
+  ASSERT_EQ(2u, data.size());
+  EXPECT_EQ(kAdNotificationTimingNumFeatures, data.num_features);
+  EXPECT_EQ(std::vector<float>({1.0f, 0.0f}), data.labels);
+
+  LogisticRegression model(data.num_features);
+  model.Train(data, GetDeterministicTrainingOptions());
+  EXPECT_GT(model.Predict(data.GetFeatures(0)),
+            model.Predict(data.GetFeatures(1)));
+}
+
+}  // namespace brave_federated
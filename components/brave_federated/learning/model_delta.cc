@@ -0,0 +1,77 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_federated/learning/model_delta.h"
+
+#include "base/bit_cast.h"
+#include "base/check_op.h"
+#include "base/numerics/safe_conversions.h"
+
+namespace brave_federated {
+
+namespace {
+
+constexpr uint8_t kModelDeltaFormatVersion = 1;
+constexpr size_t kHeaderSize = sizeof(uint8_t) + sizeof(uint32_t);
+
+void AppendUint32(uint32_t value, std::vector<uint8_t>* data) {
+  data->push_back(static_cast<uint8_t>(value >> 24));
+  data->push_back(static_cast<uint8_t>(value >> 16));
+  data->push_back(static_cast<uint8_t>(value >> 8));
+  data->push_back(static_cast<uint8_t>(value));
+}
+
+uint32_t ReadUint32(const uint8_t* data) {
+  return static_cast<uint32_t>(data[0]) << 24 |
+         static_cast<uint32_t>(data[1]) << 16 |
+         static_cast<uint32_t>(data[2]) << 8 | static_cast<uint32_t>(data[3]);
+}
+
+}  // namespace
+
+std::vector<float> ComputeModelDelta(
+    const std::vector<float>& initial_parameters,
+    const std::vector<float>& trained_parameters) {
+  DCHECK_EQ(initial_parameters.size(), trained_parameters.size());
+
+  std::vector<float> delta(trained_parameters.size());
+  for (size_t i = 0; i < delta.size(); ++i)
+    delta[i] = trained_parameters[i] - initial_parameters[i];
+  return delta;
+}
+
+std::vector<uint8_t> SerializeModelDelta(const std::vector<float>& delta) {
+  std::vector<uint8_t> data;
+  data.reserve(kHeaderSize + delta.size() * sizeof(uint32_t));
+  data.push_back(kModelDeltaFormatVersion);
+  AppendUint32(base::checked_cast<uint32_t>(delta.size()), &data);
+  for (const float value : delta)
+    AppendUint32(base::bit_cast<uint32_t>(value), &data);
+  return data;
+}
+
+absl::optional<std::vector<float>> DeserializeModelDelta(
+    base::span<const uint8_t> data) {
+  if (data.size() < kHeaderSize || data[0] != kModelDeltaFormatVersion)
+    return absl::nullopt;
+
+  // Compare against the payload size rather than computing the expected size
+  // from |size|, which could overflow for a malformed count.
+  const size_t size = ReadUint32(&data[1]);
+  const size_t payload_size = data.size() - kHeaderSize;
+  if (payload_size % sizeof(uint32_t) != 0 ||
+      payload_size / sizeof(uint32_t) != size) {
+    return absl::nullopt;
+  }
+
+  std::vector<float> delta(size);
+  for (size_t i = 0; i < size; ++i) {
+    delta[i] = base::bit_cast<float>(
+        ReadUint32(&data[kHeaderSize + i * sizeof(uint32_t)]));
+  }
+  return delta;
+}
+
+}  // namespace brave_federated
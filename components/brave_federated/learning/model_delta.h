@@ -0,0 +1,32 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_FEDERATED_LEARNING_MODEL_DELTA_H_
+#define BRAVE_COMPONENTS_BRAVE_FEDERATED_LEARNING_MODEL_DELTA_H_
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "base/containers/span.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+namespace brave_federated {
+
+// Returns how local training changed the model parameters, which is what
+// gets aggregated instead of the locally trained model itself.
+std::vector<float> ComputeModelDelta(
+    const std::vector<float>& initial_parameters,
+    const std::vector<float>& trained_parameters);
+
+// The serialized delta is a format version byte, the number of parameters as
+// a big-endian uint32 and then each parameter as a big-endian IEEE 754 float.
+std::vector<uint8_t> SerializeModelDelta(const std::vector<float>& delta);
+absl::optional<std::vector<float>> DeserializeModelDelta(
+    base::span<const uint8_t> data);
+
+}  // namespace brave_federated
+
+#endif  // BRAVE_COMPONENTS_BRAVE_FEDERATED_LEARNING_MODEL_DELTA_H_
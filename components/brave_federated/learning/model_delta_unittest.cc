@@ -0,0 +1,65 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_federated/learning/model_delta.h"
+
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=ModelDeltaTest*
+
+namespace brave_federated {
+
+TEST(ModelDeltaTest, ComputeModelDelta) {
+  EXPECT_EQ(std::vector<float>({0.5f, -1.0f, 0.0f}),
+            ComputeModelDelta({1.0f, 2.0f, 3.0f}, {1.5f, 1.0f, 3.0f}));
+}
+
+TEST(ModelDeltaTest, SerializeModelDelta) {
+  const std::vector<float> delta = {0.5f, -1.0f, 0.0f};
+  const std::vector<uint8_t> data = SerializeModelDelta(delta);
+  ASSERT_EQ(17u, data.size());
+  EXPECT_EQ(1u, data[0]);
+  // 0.5f
+  EXPECT_EQ(std::vector<uint8_t>({0x3f, 0x00, 0x00, 0x00}),
+            std::vector<uint8_t>(data.begin() + 5, data.begin() + 9));
+
+  const auto deserialized_delta = DeserializeModelDelta(data);
+  ASSERT_TRUE(deserialized_delta);
+  EXPECT_EQ(delta, *deserialized_delta);
+}
+
+TEST(ModelDeltaTest, DeserializeInvalidModelDelta) {
+  std::vector<uint8_t> data = SerializeModelDelta({0.5f, -1.0f});
+  data.pop_back();
+  EXPECT_FALSE(DeserializeModelDelta(data));
+
+  data = SerializeModelDelta({0.5f, -1.0f});
+  data[0] = 2;
+  EXPECT_FALSE(DeserializeModelDelta(data));
+
+  EXPECT_FALSE(DeserializeModelDelta({}));
+}
+
+TEST(ModelDeltaTest, DeserializeModelDeltaWithMalformedCount) {
+  // A count of 0x40000001 values would need 4 * 0x40000001 bytes, which wraps
+  // around to 4 bytes when computed in 32 bits.
+  const std::vector<uint8_t> data = {0x01, 0x40, 0x00, 0x00,
+                                     0x01, 0x3f, 0x00, 0x00, 0x00};
+  EXPECT_FALSE(DeserializeModelDelta(data));
+
+  // Count larger than the number of values.
+  std::vector<uint8_t> too_few_values = SerializeModelDelta({0.5f, -1.0f});
+  too_few_values[4] = 3;
+  EXPECT_FALSE(DeserializeModelDelta(too_few_values));
+
+  // Count smaller than the number of values.
+  std::vector<uint8_t> too_many_values = SerializeModelDelta({0.5f, -1.0f});
+  too_many_values[4] = 1;
+  EXPECT_FALSE(DeserializeModelDelta(too_many_values));
+}
+
+}  // namespace brave_federated
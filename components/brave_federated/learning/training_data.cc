@@ -0,0 +1,64 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_federated/learning/training_data.h"
+
+#include <cmath>
+
+#include "base/bind.h"
+#include "base/check_op.h"
+#include "base/numerics/math_constants.h"
+#include "base/time/time.h"
+#include "brave/components/brave_federated/data_stores/ad_notification_timing_data_store.h"
+
+namespace brave_federated {
+
+TrainingData::TrainingData(size_t num_features)
+    : num_features(num_features) {}
+
+TrainingData::TrainingData(const TrainingData& other) = default;
+
+TrainingData::TrainingData(TrainingData&& other) = default;
+
+TrainingData& TrainingData::operator=(const TrainingData& other) = default;
+
+TrainingData& TrainingData::operator=(TrainingData&& other) = default;
+
+TrainingData::~TrainingData() = default;
+
+void TrainingData::AddInstance(const std::vector<float>& instance_features,
+                               float label) {
+  DCHECK_EQ(num_features, instance_features.size());
+  features.insert(features.end(), instance_features.begin(),
+                  instance_features.end());
+  labels.push_back(label);
+}
+
+TrainingData LoadAdNotificationTimingTrainingData(
+    AdNotificationTimingDataStore* data_store) {
+  DCHECK(data_store);
+
+  TrainingData training_data(kAdNotificationTimingNumFeatures);
+  data_store->ForEachLog(base::BindRepeating(
+      [](TrainingData* training_data, const AdNotificationTimingTaskLog& log) {
+        base::Time::Exploded exploded;
+        log.time.LocalExplode(&exploded);
+        // The hour of the day is cyclic, so encode it on the unit circle for
+        // 23:00 to be as close to 00:00 as 01:00 is.
+        const double angle =
+            2 * base::kPiDouble * (exploded.hour * 60 + exploded.minute) /
+            (24 * 60);
+        training_data->AddInstance(
+            {static_cast<float>(std::sin(angle)),
+             static_cast<float>(std::cos(angle)),
+             static_cast<float>(std::log1p(log.number_of_tabs))},
+            log.label ? 1.0f : 0.0f);
+      },
+      &training_data));
+
+  return training_data;
+}
+
+}  // namespace brave_federated
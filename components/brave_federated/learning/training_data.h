@@ -0,0 +1,51 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_FEDERATED_LEARNING_TRAINING_DATA_H_
+#define BRAVE_COMPONENTS_BRAVE_FEDERATED_LEARNING_TRAINING_DATA_H_
+
+#include <stddef.h>
+
+#include <vector>
+
+namespace brave_federated {
+
+class AdNotificationTimingDataStore;
+
+// Training instances stored as dense float arrays so that models can iterate
+// over them without per-instance allocations.
+struct TrainingData {
+  explicit TrainingData(size_t num_features);
+  TrainingData(const TrainingData& other);
+  TrainingData(TrainingData&& other);
+  TrainingData& operator=(const TrainingData& other);
+  TrainingData& operator=(TrainingData&& other);
+  ~TrainingData();
+
+  void AddInstance(const std::vector<float>& instance_features, float label);
+
+  size_t size() const { return labels.size(); }
+  const float* GetFeatures(size_t index) const {
+    return features.data() + index * num_features;
+  }
+
+  size_t num_features;
+  // Row-major, |num_features| values per instance.
+  std::vector<float> features;
+  std::vector<float> labels;
+};
+
+// Features of the ad notification timing task, see
+// AdNotificationTimingDataStore for what is logged.
+constexpr size_t kAdNotificationTimingNumFeatures = 3;
+
+// Reads the logs of |data_store| into training instances. Must be called on
+// the sequence of |data_store|.
+TrainingData LoadAdNotificationTimingTrainingData(
+    AdNotificationTimingDataStore* data_store);
+
+}  // namespace brave_federated
+
+#endif  // BRAVE_COMPONENTS_BRAVE_FEDERATED_LEARNING_TRAINING_DATA_H_
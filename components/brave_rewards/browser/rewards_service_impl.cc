@@ -290,6 +290,14 @@ bool IsMediaLink(const GURL& url,
                                      referrer.spec());
 }
 
+bool IsMediaXHRLink(const GURL& url,
+                    const GURL& first_party_url,
+                    const GURL& referrer) {
+  return ledger::Ledger::IsMediaXHRLink(url.spec(),
+                                        first_party_url.spec(),
+                                        referrer.spec());
+}
+
 
 // read comment about file pathes at src\base\files\file_path.h
 #if defined(OS_WIN)
@@ -686,6 +694,7 @@ void RewardsServiceImpl::OnLoad(SessionID tab_id, const GURL& url) {
   data->path = url.path();
   data->tab_id = tab_id.id();
   data->url = publisher_url;
+  FlushTabEvents();
   bat_ledger_->OnLoad(std::move(data), GetCurrentTimestamp());
 }
 
@@ -694,39 +703,61 @@ void RewardsServiceImpl::OnUnload(SessionID tab_id) {
     return;
   }
 
+  FlushTabEvents();
   bat_ledger_->OnUnload(tab_id.id(), GetCurrentTimestamp());
 }
 
 void RewardsServiceImpl::OnShow(SessionID tab_id) {
-  if (!Connected()) {
-    return;
-  }
-
-  bat_ledger_->OnShow(tab_id.id(), GetCurrentTimestamp());
+  AddTabEvent(bat_ledger::mojom::TabEventType::SHOW, tab_id);
 }
 
 void RewardsServiceImpl::OnHide(SessionID tab_id) {
+  AddTabEvent(bat_ledger::mojom::TabEventType::HIDE, tab_id);
+}
+
+void RewardsServiceImpl::OnForeground(SessionID tab_id) {
+  AddTabEvent(bat_ledger::mojom::TabEventType::FOREGROUND, tab_id);
+}
+
+void RewardsServiceImpl::OnBackground(SessionID tab_id) {
+  AddTabEvent(bat_ledger::mojom::TabEventType::BACKGROUND, tab_id);
+}
+
+void RewardsServiceImpl::AddTabEvent(
+    const bat_ledger::mojom::TabEventType type,
+    SessionID tab_id) {
   if (!Connected()) {
     return;
   }
 
-  bat_ledger_->OnHide(tab_id.id(), GetCurrentTimestamp());
+  auto tab_event = bat_ledger::mojom::TabEvent::New();
+  tab_event->type = type;
+  tab_event->tab_id = tab_id.id();
+  tab_event->current_time = GetCurrentTimestamp();
+  pending_tab_events_.push_back(std::move(tab_event));
+
+  // Switching tabs or windows raises several visibility changes in the same
+  // task, so send them to the ledger together
+  if (pending_tab_events_.size() == 1) {
+    base::SequencedTaskRunnerHandle::Get()->PostTask(
+        FROM_HERE,
+        base::BindOnce(&RewardsServiceImpl::FlushTabEvents, AsWeakPtr()));
+  }
 }
 
-void RewardsServiceImpl::OnForeground(SessionID tab_id) {
-  if (!Connected()) {
+void RewardsServiceImpl::FlushTabEvents() {
+  if (pending_tab_events_.empty()) {
     return;
   }
 
-  bat_ledger_->OnForeground(tab_id.id(), GetCurrentTimestamp());
-}
+  std::vector<bat_ledger::mojom::TabEventPtr> tab_events;
+  tab_events.swap(pending_tab_events_);
 
-void RewardsServiceImpl::OnBackground(SessionID tab_id) {
   if (!Connected()) {
     return;
   }
 
-  bat_ledger_->OnBackground(tab_id.id(), GetCurrentTimestamp());
+  bat_ledger_->OnTabEvents(std::move(tab_events));
 }
 
 void RewardsServiceImpl::OnPostData(SessionID tab_id,
@@ -758,6 +789,7 @@ void RewardsServiceImpl::OnPostData(SessionID tab_id,
   data->path = url.spec(),
   data->tab_id = tab_id.id();
 
+  FlushTabEvents();
   bat_ledger_->OnPostData(url.spec(),
                           first_party_url.spec(),
                           referrer.spec(),
@@ -777,6 +809,12 @@ void RewardsServiceImpl::OnXHRLoad(SessionID tab_id,
     return;
   }
 
+  // Almost all requests are unrelated to media, so avoid sending them to the
+  // ledger
+  if (!IsMediaXHRLink(url, first_party_url, referrer)) {
+    return;
+  }
+
   base::flat_map<std::string, std::string> parts;
 
   for (net::QueryIterator it(url); !it.IsAtEnd(); it.Advance()) {
@@ -787,6 +825,7 @@ void RewardsServiceImpl::OnXHRLoad(SessionID tab_id,
   data->path = url.spec();
   data->tab_id = tab_id.id();
 
+  FlushTabEvents();
   bat_ledger_->OnXHRLoad(tab_id.id(),
                          url.spec(),
                          parts,
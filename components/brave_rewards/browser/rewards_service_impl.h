@@ -467,6 +467,10 @@ class RewardsServiceImpl : public RewardsService,
   void StopNotificationTimers();
   void OnNotificationTimerFired();
 
+  void AddTabEvent(const bat_ledger::mojom::TabEventType type,
+                   SessionID tab_id);
+  void FlushTabEvents();
+
   void MaybeShowNotificationAddFunds();
   bool ShouldShowNotificationAddFunds() const;
   void ShowNotificationAddFunds(bool sufficient);
@@ -803,6 +807,7 @@ class RewardsServiceImpl : public RewardsService,
   std::unique_ptr<base::OneShotTimer> notification_startup_timer_;
   std::unique_ptr<base::RepeatingTimer> notification_periodic_timer_;
   PrefChangeRegistrar profile_pref_change_registrar_;
+  std::vector<bat_ledger::mojom::TabEventPtr> pending_tab_events_;
 
   uint32_t next_timer_id_;
   int32_t country_id_ = 0;
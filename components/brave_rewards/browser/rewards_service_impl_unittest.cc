@@ -157,4 +157,20 @@ TEST_F(RewardsServiceTest, GetExternalWalletMultipleCustodians) {
 }
 #endif
 
+TEST_F(RewardsServiceTest, IsMediaXHRLink) {
+  EXPECT_FALSE(IsMediaXHRLink(GURL("https://brave.com/static/app.js"),
+                              GURL("https://brave.com/"), GURL()));
+
+  const GURL youtube_url(
+      "https://www.youtube.com/api/stats/watchtime?docid=A&st=0&et=10");
+#if defined(OS_ANDROID)
+  EXPECT_TRUE(IsMediaXHRLink(youtube_url, GURL("https://www.youtube.com/"),
+                             GURL()));
+#else
+  // Media publishers are handled by Greaselion on desktop
+  EXPECT_FALSE(IsMediaXHRLink(youtube_url, GURL("https://www.youtube.com/"),
+                              GURL()));
+#endif
+}
+
 }  // namespace brave_rewards
@@ -13,9 +13,11 @@
 #include <utility>
 
 #include "base/barrier_callback.h"
+#include "base/bind.h"
 #include "base/callback.h"
 #include "base/containers/flat_set.h"
 #include "base/logging.h"
+#include "base/task/thread_pool.h"
 #include "base/time/time.h"
 #include "brave/components/brave_private_cdn/headers.h"
 #include "brave/components/brave_today/browser/network.h"
@@ -27,6 +29,8 @@
 #include "components/prefs/pref_service.h"
 #include "net/base/load_flags.h"
 #include "net/http/http_request_headers.h"
+#include "net/http/http_response_headers.h"
+#include "net/http/http_status_code.h"
 #include "services/network/public/cpp/resource_request.h"
 #include "services/network/public/cpp/shared_url_loader_factory.h"
 #include "services/network/public/cpp/simple_url_loader.h"
@@ -64,6 +68,23 @@ mojom::ArticlePtr RustFeedItemToArticle(const FeedItem& rust_feed_item) {
   return article;
 }
 
+std::unique_ptr<DirectFeedResponse> ParseFeedResponse(
+    std::unique_ptr<DirectFeedResponse> result,
+    const std::string& body_content) {
+  // Reponse is valid, but still might not be a feed
+  FeedData data;
+  if (!parse_feed_string(::rust::String(body_content), data)) {
+    VLOG(1) << result->url.spec() << " not a valid feed.";
+    VLOG(2) << "Response body was:";
+    VLOG(2) << body_content;
+    return result;
+  }
+  // Valid feed
+  result->success = true;
+  result->data = std::move(data);
+  return result;
+}
+
 }  // namespace
 
 DirectFeedController::DirectFeedController(
@@ -184,6 +205,19 @@ void DirectFeedController::DownloadFeed(const GURL& feed_url,
   request->load_flags = net::LOAD_DO_NOT_SAVE_COOKIES;
   request->credentials_mode = network::mojom::CredentialsMode::kOmit;
   request->method = net::HttpRequestHeaders::kGetMethod;
+  // Only have the feed sent and parsed again if it changed since the last
+  // time it was downloaded.
+  auto cached_feed = feed_cache_.find(feed_url);
+  if (cached_feed != feed_cache_.end()) {
+    if (!cached_feed->second.etag.empty()) {
+      request->headers.SetHeader(net::HttpRequestHeaders::kIfNoneMatch,
+                                 cached_feed->second.etag);
+    }
+    if (!cached_feed->second.last_modified.empty()) {
+      request->headers.SetHeader(net::HttpRequestHeaders::kIfModifiedSince,
+                                 cached_feed->second.last_modified);
+    }
+  }
   auto url_loader = network::SimpleURLLoader::Create(
       std::move(request), GetNetworkTrafficAnnotationTag());
   url_loader->SetRetryOptions(
@@ -207,37 +241,58 @@ void DirectFeedController::OnResponse(
   // Parse response data
   auto* loader = iter->get();
   auto response_code = -1;
-  base::flat_map<std::string, std::string> headers;
+  std::string etag;
+  std::string last_modified;
   if (loader->ResponseInfo()) {
     auto headers_list = loader->ResponseInfo()->headers;
     if (headers_list) {
       response_code = headers_list->response_code();
+      headers_list->GetNormalizedHeader("etag", &etag);
+      headers_list->GetNormalizedHeader("last-modified", &last_modified);
     }
   }
   url_loaders_.erase(iter);
-  // Validate if we get a feed
-  std::string body_content = response_body ? *response_body : "";
   // TODO(petemill): handle any url redirects and change the stored feed url?
   auto result = std::make_unique<DirectFeedResponse>(DirectFeedResponse());
   result->url = feed_url;
-  if (response_code < 200 || response_code >= 300 || body_content.empty()) {
+  // Feed hasn't changed, so use what was parsed last time.
+  if (response_code == net::HTTP_NOT_MODIFIED) {
+    auto cached_feed = feed_cache_.find(feed_url);
+    if (cached_feed != feed_cache_.end()) {
+      VLOG(1) << feed_url.spec() << " not modified, using cached feed.";
+      result->success = true;
+      result->data = cached_feed->second.data;
+      std::move(callback).Run(std::move(result));
+      return;
+    }
+  }
+  // Validate if we get a feed
+  if (response_code < 200 || response_code >= 300 || !response_body ||
+      response_body->empty()) {
     VLOG(1) << feed_url.spec()
             << " invalid response, status: " << response_code;
     std::move(callback).Run(std::move(result));
     return;
   }
-  // Reponse is valid, but still might not be a feed
-  FeedData data;
-  if (!parse_feed_string(::rust::String(body_content), data)) {
-    VLOG(1) << feed_url.spec() << " not a valid feed.";
-    VLOG(2) << "Response body was:";
-    VLOG(2) << body_content;
-    std::move(callback).Run(std::move(result));
-    return;
+  // Large feeds can take a while to parse, so keep it off the UI thread.
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::TaskPriority::USER_VISIBLE},
+      base::BindOnce(&ParseFeedResponse, std::move(result), *response_body),
+      base::BindOnce(&DirectFeedController::OnParsedFeed,
+                     weak_ptr_factory_.GetWeakPtr(), std::move(callback), etag,
+                     last_modified));
+}
+
+void DirectFeedController::OnParsedFeed(
+    DownloadFeedCallback callback,
+    const std::string& etag,
+    const std::string& last_modified,
+    std::unique_ptr<DirectFeedResponse> result) {
+  if (!result->success || (etag.empty() && last_modified.empty())) {
+    feed_cache_.erase(result->url);
+  } else {
+    feed_cache_[result->url] = {etag, last_modified, result->data};
   }
-  // Valid feed
-  result->success = true;
-  result->data = data;
   std::move(callback).Run(std::move(result));
 }
 
@@ -12,7 +12,9 @@
 #include <vector>
 
 #include "base/callback_forward.h"
+#include "base/containers/flat_map.h"
 #include "base/memory/scoped_refptr.h"
+#include "base/memory/weak_ptr.h"
 #include "brave/components/brave_today/common/brave_news.mojom-forward.h"
 #include "brave/components/brave_today/rust/lib.rs.h"
 #include "url/gurl.h"
@@ -59,6 +61,14 @@ class DirectFeedController {
                           GetFeedItemsCallback callback);
 
  private:
+  // The last successfully parsed content of a feed, along with the validators
+  // needed to make a conditional request for it.
+  struct CachedFeed {
+    std::string etag;
+    std::string last_modified;
+    FeedData data;
+  };
+
   using SimpleURLLoaderList =
       std::list<std::unique_ptr<network::SimpleURLLoader>>;
   void DownloadFeedContent(const GURL& feed_url,
@@ -69,9 +79,15 @@ class DirectFeedController {
                   DownloadFeedCallback callback,
                   const GURL& feed_url,
                   const std::unique_ptr<std::string> response_body);
+  void OnParsedFeed(DownloadFeedCallback callback,
+                    const std::string& etag,
+                    const std::string& last_modified,
+                    std::unique_ptr<DirectFeedResponse> result);
 
   SimpleURLLoaderList url_loaders_;
   scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
+  base::flat_map<GURL, CachedFeed> feed_cache_;
+  base::WeakPtrFactory<DirectFeedController> weak_ptr_factory_{this};
 };
 
 }  // namespace brave_news
@@ -3,6 +3,8 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this file,
 // you can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include "brave/components/brave_today/browser/direct_feed_controller.h"
+
 #include <algorithm>
 #include <iterator>
 #include <memory>
@@ -12,7 +14,15 @@
 
 #include "base/containers/flat_map.h"
 #include "base/logging.h"
+#include "base/test/bind.h"
+#include "base/test/task_environment.h"
 #include "brave/components/brave_today/rust/lib.rs.h"
+#include "net/http/http_request_headers.h"
+#include "net/http/http_response_headers.h"
+#include "services/network/public/cpp/url_loader_completion_status.h"
+#include "services/network/public/cpp/weak_wrapper_shared_url_loader_factory.h"
+#include "services/network/test/test_url_loader_factory.h"
+#include "services/network/test/test_utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
 namespace brave_news {
@@ -140,4 +150,50 @@ TEST(BraveNewsDirectFeed, ParseFeed) {
             "c5f85f34aa685221604f7e434415ca82");
 }
 
+TEST(BraveNewsDirectFeed, ReuseFeedWhenNotModified) {
+  base::test::TaskEnvironment task_environment;
+  network::TestURLLoaderFactory url_loader_factory;
+  DirectFeedController controller(
+      base::MakeRefCounted<network::WeakWrapperSharedURLLoaderFactory>(
+          &url_loader_factory));
+  const GURL feed_url("https://www.example.com/feed.xml");
+
+  auto head = network::CreateURLResponseHead(net::HTTP_OK);
+  head->headers->SetHeader("ETag", "\"1\"");
+  url_loader_factory.AddResponse(feed_url, std::move(head), GetFeedJson(),
+                                 network::URLLoaderCompletionStatus());
+
+  bool is_valid = false;
+  std::string title;
+  auto verify_callback = base::BindLambdaForTesting(
+      [&](bool result_is_valid, const std::string& result_title) {
+        is_valid = result_is_valid;
+        title = result_title;
+      });
+  controller.VerifyFeedUrl(feed_url, verify_callback);
+  task_environment.RunUntilIdle();
+  EXPECT_TRUE(is_valid);
+  EXPECT_FALSE(title.empty());
+
+  // The feed is requested again with its validator and the server responds
+  // without a body, so the previously parsed feed is used.
+  std::string if_none_match;
+  url_loader_factory.SetInterceptor(
+      base::BindLambdaForTesting([&](const network::ResourceRequest& request) {
+        request.headers.GetHeader(net::HttpRequestHeaders::kIfNoneMatch,
+                                  &if_none_match);
+      }));
+  url_loader_factory.AddResponse(
+      feed_url, network::CreateURLResponseHead(net::HTTP_NOT_MODIFIED), "",
+      network::URLLoaderCompletionStatus());
+
+  is_valid = false;
+  title.clear();
+  controller.VerifyFeedUrl(feed_url, verify_callback);
+  task_environment.RunUntilIdle();
+  EXPECT_EQ("\"1\"", if_none_match);
+  EXPECT_TRUE(is_valid);
+  EXPECT_FALSE(title.empty());
+}
+
 }  // namespace brave_news
@@ -15,6 +15,7 @@
 #include "base/bind.h"
 #include "base/callback_forward.h"
 #include "base/one_shot_event.h"
+#include "base/task/thread_pool.h"
 #include "brave/components/api_request_helper/api_request_helper.h"
 #include "brave/components/brave_private_cdn/headers.h"
 #include "brave/components/brave_today/browser/direct_feed_controller.h"
@@ -26,6 +27,8 @@
 #include "brave/components/brave_today/common/brave_news.mojom.h"
 #include "components/history/core/browser/history_service.h"
 #include "components/history/core/browser/history_types.h"
+#include "net/http/http_request_headers.h"
+#include "net/http/http_status_code.h"
 
 namespace brave_news {
 
@@ -39,6 +42,21 @@ GURL GetFeedUrl() {
   return feed_url;
 }
 
+absl::optional<FeedItems> ParseCombinedFeed(const std::string& body) {
+  FeedItems feed_items;
+  if (!ParseFeedItems(body, &feed_items))
+    return absl::nullopt;
+  return feed_items;
+}
+
+FeedItems CloneFeedItems(const FeedItems& feed_items) {
+  FeedItems clone;
+  clone.reserve(feed_items.size());
+  for (const auto& item : feed_items)
+    clone.push_back(item->Clone());
+  return clone;
+}
+
 }  // namespace
 
 FeedController::FeedController(
@@ -233,6 +251,8 @@ void FeedController::UpdateIfRemoteChanged() {
 
 void FeedController::ClearCache() {
   ResetFeed();
+  current_feed_etag_.clear();
+  combined_feed_items_.clear();
 }
 
 void FeedController::OnPublishersUpdated(PublishersController* controller) {
@@ -243,14 +263,23 @@ void FeedController::OnPublishersUpdated(PublishersController* controller) {
 void FeedController::FetchCombinedFeed(GetFeedItemsCallback callback) {
   // Handle the response
   auto response_handler = base::BindOnce(
-      [](FeedController* controller, GetFeedItemsCallback callback, int status,
-         const std::string& body,
+      [](base::WeakPtr<FeedController> controller,
+         GetFeedItemsCallback callback, int status, const std::string& body,
          const base::flat_map<std::string, std::string>& headers) {
+        if (!controller)
+          return;
         std::string etag;
         if (headers.contains(kEtagHeaderKey)) {
           etag = headers.at(kEtagHeaderKey);
         }
         VLOG(1) << "Downloaded feed, status: " << status << " etag: " << etag;
+        // Remote feed hasn't changed, so reuse the items we already parsed.
+        if (status == net::HTTP_NOT_MODIFIED &&
+            !controller->combined_feed_items_.empty()) {
+          std::move(callback).Run(
+              CloneFeedItems(controller->combined_feed_items_));
+          return;
+        }
         // Handle bad response
         if (status != 200 || body.empty()) {
           LOG(ERROR) << "Bad response from brave news feed.json. Status: "
@@ -258,20 +287,41 @@ void FeedController::FetchCombinedFeed(GetFeedItemsCallback callback) {
           std::move(callback).Run({});
           return;
         }
-        // Only mark cache time of remote request if
-        // parsing was successful
-        controller->current_feed_etag_ = etag;
-        FeedItems feed_items;
-        ParseFeedItems(body, &feed_items);
-        std::move(callback).Run(std::move(feed_items));
+        // The feed can be large, so parse it off the UI thread.
+        base::ThreadPool::PostTaskAndReplyWithResult(
+            FROM_HERE, {base::TaskPriority::USER_VISIBLE},
+            base::BindOnce(&ParseCombinedFeed, body),
+            base::BindOnce(&FeedController::OnParsedCombinedFeed, controller,
+                           std::move(callback), etag));
       },
-      base::Unretained(this), std::move(callback));
+      weak_ptr_factory_.GetWeakPtr(), std::move(callback));
+  // Only have the feed sent again if it changed since we last parsed it.
+  auto headers = brave::private_cdn_headers;
+  if (!current_feed_etag_.empty() && !combined_feed_items_.empty()) {
+    headers[net::HttpRequestHeaders::kIfNoneMatch] = current_feed_etag_;
+  }
   // Send the request
   GURL feed_url(GetFeedUrl());
   VLOG(1) << "Making feed request to " << feed_url.spec();
   api_request_helper_->Request("GET", feed_url, "", "", true,
-                               std::move(response_handler),
-                               brave::private_cdn_headers);
+                               std::move(response_handler), headers);
+}
+
+void FeedController::OnParsedCombinedFeed(
+    GetFeedItemsCallback callback,
+    const std::string& etag,
+    absl::optional<FeedItems> feed_items) {
+  if (!feed_items) {
+    LOG(ERROR) << "Could not parse brave news feed.json.";
+    combined_feed_items_.clear();
+    std::move(callback).Run({});
+    return;
+  }
+  // Only mark cache time of remote request if
+  // parsing was successful
+  current_feed_etag_ = etag;
+  combined_feed_items_ = CloneFeedItems(*feed_items);
+  std::move(callback).Run(std::move(*feed_items));
 }
 
 void FeedController::GetOrFetchFeed(base::OnceClosure callback) {
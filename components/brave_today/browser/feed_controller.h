@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "base/memory/raw_ptr.h"
+#include "base/memory/weak_ptr.h"
 #include "base/one_shot_event.h"
 #include "base/scoped_observation.h"
 #include "brave/components/api_request_helper/api_request_helper.h"
@@ -18,6 +19,7 @@
 #include "brave/components/brave_today/browser/publishers_controller.h"
 #include "brave/components/brave_today/common/brave_news.mojom.h"
 #include "components/history/core/browser/history_service.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 
 namespace history {
 class HistoryService;
@@ -65,6 +67,9 @@ class FeedController : public PublishersController::Observer {
 
  private:
   void FetchCombinedFeed(GetFeedItemsCallback callback);
+  void OnParsedCombinedFeed(GetFeedItemsCallback callback,
+                            const std::string& etag,
+                            absl::optional<FeedItems> feed_items);
   void GetOrFetchFeed(base::OnceClosure callback);
   void ResetFeed();
   void NotifyUpdateDone();
@@ -85,7 +90,12 @@ class FeedController : public PublishersController::Observer {
   // every time the UI opens.
   mojom::Feed current_feed_;
   std::string current_feed_etag_;
+  // Items parsed from the combined feed matching |current_feed_etag_|, so
+  // that the feed can be rebuilt without downloading and parsing it again
+  // when the remote feed hasn't changed.
+  FeedItems combined_feed_items_;
   bool is_update_in_progress_ = false;
+  base::WeakPtrFactory<FeedController> weak_ptr_factory_{this};
 };
 
 }  // namespace brave_news
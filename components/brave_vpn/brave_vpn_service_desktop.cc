@@ -12,6 +12,7 @@
 #include "base/bind.h"
 #include "base/command_line.h"
 #include "base/json/json_reader.h"
+#include "base/json/values_util.h"
 #include "base/logging.h"
 #include "base/notreached.h"
 #include "base/strings/string_split.h"
@@ -38,6 +39,39 @@ constexpr char kRegionContinentKey[] = "continent";
 constexpr char kRegionNameKey[] = "name";
 constexpr char kRegionNamePrettyKey[] = "name-pretty";
 
+constexpr char kHostnamesCacheLastUpdatedKey[] = "last_updated";
+constexpr char kHostnamesCacheListKey[] = "hostnames";
+
+// Cached hostnames older than this are not used for connecting.
+constexpr base::TimeDelta kHostnamesCacheTTL = base::Hours(1);
+
+std::vector<brave_vpn::Hostname> ParseHostnames(
+    const base::Value& hostnames_value) {
+  constexpr char kHostnameKey[] = "hostname";
+  constexpr char kDisplayNameKey[] = "display-name";
+  constexpr char kOfflineKey[] = "offline";
+  constexpr char kCapacityScoreKey[] = "capacity-score";
+
+  std::vector<brave_vpn::Hostname> hostnames;
+  for (const auto& value : hostnames_value.GetList()) {
+    DCHECK(value.is_dict());
+    if (!value.is_dict())
+      continue;
+
+    const std::string* hostname_str = value.FindStringKey(kHostnameKey);
+    const std::string* display_name_str = value.FindStringKey(kDisplayNameKey);
+    absl::optional<bool> offline = value.FindBoolKey(kOfflineKey);
+    absl::optional<int> capacity_score = value.FindIntKey(kCapacityScoreKey);
+
+    if (!hostname_str || !display_name_str || !offline || !capacity_score)
+      continue;
+
+    hostnames.push_back(brave_vpn::Hostname{*hostname_str, *display_name_str,
+                                            *offline, *capacity_score});
+  }
+  return hostnames;
+}
+
 std::string GetStringFor(ConnectionState state) {
   switch (state) {
     case ConnectionState::CONNECTED:
@@ -175,6 +209,7 @@ void BraveVpnServiceDesktop::OnCreated() {
 void BraveVpnServiceDesktop::OnCreateFailed() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
   VLOG(2) << __func__;
+  RecordHostnameConnectTime(false);
   UpdateAndNotifyConnectionStateChange(ConnectionState::CONNECT_FAILED);
 }
 
@@ -234,6 +269,7 @@ void BraveVpnServiceDesktop::OnConnected() {
     return;
   }
 
+  RecordHostnameConnectTime(true);
   UpdateAndNotifyConnectionStateChange(ConnectionState::CONNECTED);
 }
 
@@ -250,6 +286,7 @@ void BraveVpnServiceDesktop::OnConnectFailed() {
   VLOG(2) << __func__;
 
   cancel_connecting_ = false;
+  RecordHostnameConnectTime(false);
   UpdateAndNotifyConnectionStateChange(ConnectionState::CONNECT_FAILED);
 }
 
@@ -311,6 +348,7 @@ void BraveVpnServiceDesktop::Connect() {
 
   VLOG(2) << __func__ << " : start connecting!";
   UpdateAndNotifyConnectionStateChange(ConnectionState::CONNECTING);
+  connect_start_time_ = base::TimeTicks::Now();
 
   if (is_simulation_ || connection_info_.IsValid()) {
     VLOG(2) << __func__
@@ -327,6 +365,11 @@ void BraveVpnServiceDesktop::Connect() {
             << target_region_name;
   }
 
+  if (PickHostnameFromCache(target_region_name)) {
+    FetchSubscriberCredential();
+    return;
+  }
+
   FetchHostnamesForRegion(target_region_name);
 }
 
@@ -396,7 +439,7 @@ void BraveVpnServiceDesktop::GetPurchasedState(
 void BraveVpnServiceDesktop::FetchRegionData() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
   VLOG(2) << __func__ << " : Start fetching region data";
-  // Unretained is safe here becasue this class owns request helper.
+  // Unretained is safe here because this class owns request helper.
   GetAllServerRegions(base::BindOnce(&BraveVpnServiceDesktop::OnFetchRegionList,
                                      base::Unretained(this)));
 }
@@ -762,7 +805,7 @@ void BraveVpnServiceDesktop::FetchHostnamesForRegion(const std::string& name) {
   // Hostname will be replaced with latest one.
   hostname_.reset();
 
-  // Unretained is safe here becasue this class owns request helper.
+  // Unretained is safe here because this class owns request helper.
   GetHostnamesForRegion(
       base::BindOnce(&BraveVpnServiceDesktop::OnFetchHostnames,
                      base::Unretained(this), name),
@@ -807,28 +850,7 @@ void BraveVpnServiceDesktop::ParseAndCacheHostnames(
     return;
   }
 
-  constexpr char kHostnameKey[] = "hostname";
-  constexpr char kDisplayNameKey[] = "display-name";
-  constexpr char kOfflineKey[] = "offline";
-  constexpr char kCapacityScoreKey[] = "capacity-score";
-
-  std::vector<brave_vpn::Hostname> hostnames;
-  for (const auto& value : hostnames_value.GetList()) {
-    DCHECK(value.is_dict());
-    if (!value.is_dict())
-      continue;
-
-    const std::string* hostname_str = value.FindStringKey(kHostnameKey);
-    const std::string* display_name_str = value.FindStringKey(kDisplayNameKey);
-    absl::optional<bool> offline = value.FindBoolKey(kOfflineKey);
-    absl::optional<int> capacity_score = value.FindIntKey(kCapacityScoreKey);
-
-    if (!hostname_str || !display_name_str || !offline || !capacity_score)
-      continue;
-
-    hostnames.push_back(brave_vpn::Hostname{*hostname_str, *display_name_str,
-                                            *offline, *capacity_score});
-  }
+  std::vector<brave_vpn::Hostname> hostnames = ParseHostnames(hostnames_value);
 
   VLOG(2) << __func__ << " : has hostname: " << !hostnames.empty();
 
@@ -838,6 +860,7 @@ void BraveVpnServiceDesktop::ParseAndCacheHostnames(
     return;
   }
 
+  CacheHostnames(region, hostnames_value);
   hostname_ = PickBestHostname(hostnames);
   if (hostname_->hostname.empty()) {
     VLOG(2) << __func__ << " : got empty hostnames list for " << region;
@@ -849,6 +872,90 @@ void BraveVpnServiceDesktop::ParseAndCacheHostnames(
           << hostname_->display_name << ", " << hostname_->is_offline << ", "
           << hostname_->capacity_score;
 
+  FetchSubscriberCredential();
+}
+
+bool BraveVpnServiceDesktop::PickHostnameFromCache(const std::string& region) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  const base::Value* cache =
+      prefs_->GetDictionary(brave_vpn::prefs::kBraveVPNHostnamesCache)
+          ->FindDictKey(region);
+  if (!cache)
+    return false;
+
+  absl::optional<base::Time> last_updated =
+      base::ValueToTime(cache->FindKey(kHostnamesCacheLastUpdatedKey));
+  const base::Value* hostnames_value =
+      cache->FindListKey(kHostnamesCacheListKey);
+  if (!last_updated || !hostnames_value)
+    return false;
+
+  const base::TimeDelta age = base::Time::Now() - *last_updated;
+  if (age.is_negative() || age > kHostnamesCacheTTL) {
+    VLOG(2) << __func__ << " : cached hostnames are stale for " << region;
+    return false;
+  }
+
+  std::unique_ptr<brave_vpn::Hostname> hostname =
+      PickBestHostname(ParseHostnames(*hostnames_value));
+  if (hostname->hostname.empty())
+    return false;
+
+  VLOG(2) << __func__ << " : Picked " << hostname->hostname
+          << " from cached hostnames for " << region;
+  hostname_ = std::move(hostname);
+
+  // Keep the cache warm for the next connect without delaying this one.
+  // Unretained is safe here because this class owns request helper.
+  GetHostnamesForRegion(
+      base::BindOnce(&BraveVpnServiceDesktop::OnRefreshHostnames,
+                     base::Unretained(this), region),
+      region);
+  return true;
+}
+
+void BraveVpnServiceDesktop::OnRefreshHostnames(const std::string& region,
+                                                const std::string& hostnames,
+                                                bool success) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  if (!success) {
+    VLOG(2) << __func__ << " : failed to refresh hostnames for " << region;
+    return;
+  }
+
+  absl::optional<base::Value> value = base::JSONReader::Read(hostnames);
+  if (value && value->is_list() && !ParseHostnames(*value).empty())
+    CacheHostnames(region, *value);
+}
+
+void BraveVpnServiceDesktop::CacheHostnames(
+    const std::string& region,
+    const base::Value& hostnames_value) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  base::Value cache(base::Value::Type::DICTIONARY);
+  cache.SetKey(kHostnamesCacheLastUpdatedKey,
+               base::TimeToValue(base::Time::Now()));
+  cache.SetKey(kHostnamesCacheListKey, hostnames_value.Clone());
+
+  DictionaryPrefUpdate update(prefs_,
+                              brave_vpn::prefs::kBraveVPNHostnamesCache);
+  update->SetKey(region, std::move(cache));
+}
+
+void BraveVpnServiceDesktop::RecordHostnameConnectTime(bool success) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  const std::string hostname = connection_info_.hostname();
+  if (connect_start_time_.is_null() || hostname.empty())
+    return;
+
+  hostname_connect_times_[hostname] =
+      success ? base::TimeTicks::Now() - connect_start_time_
+              : base::TimeDelta::Max();
+  connect_start_time_ = base::TimeTicks();
+}
+
+void BraveVpnServiceDesktop::FetchSubscriberCredential() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
   if (skus_credential_.empty()) {
     VLOG(2) << __func__ << " : skus_credential is empty";
     UpdateAndNotifyConnectionStateChange(ConnectionState::CONNECT_FAILED);
@@ -966,22 +1073,7 @@ void BraveVpnServiceDesktop::OnGetProfileCredentials(
 std::unique_ptr<brave_vpn::Hostname> BraveVpnServiceDesktop::PickBestHostname(
     const std::vector<brave_vpn::Hostname>& hostnames) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
-  std::vector<brave_vpn::Hostname> filtered_hostnames;
-  std::copy_if(
-      hostnames.begin(), hostnames.end(),
-      std::back_inserter(filtered_hostnames),
-      [](const brave_vpn::Hostname& hostname) { return !hostname.is_offline; });
-
-  std::sort(filtered_hostnames.begin(), filtered_hostnames.end(),
-            [](const brave_vpn::Hostname& a, const brave_vpn::Hostname& b) {
-              return a.capacity_score > b.capacity_score;
-            });
-
-  if (filtered_hostnames.empty())
-    return std::make_unique<brave_vpn::Hostname>();
-
-  // Pick highest capacity score.
-  return std::make_unique<brave_vpn::Hostname>(filtered_hostnames[0]);
+  return brave_vpn::PickBestHostname(hostnames, hostname_connect_times_);
 }
 
 brave_vpn::BraveVPNOSConnectionAPI*
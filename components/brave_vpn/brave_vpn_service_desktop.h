@@ -10,8 +10,10 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/scoped_observation.h"
 #include "base/sequence_checker.h"
+#include "base/time/time.h"
 #include "base/timer/timer.h"
 #include "brave/components/brave_vpn/brave_vpn.mojom.h"
 #include "brave/components/brave_vpn/brave_vpn_connection_info.h"
@@ -81,6 +83,7 @@ class BraveVpnServiceDesktop
   friend class BraveBrowserCommandControllerTest;
   FRIEND_TEST_ALL_PREFIXES(BraveVPNServiceTest, RegionDataTest);
   FRIEND_TEST_ALL_PREFIXES(BraveVPNServiceTest, HostnamesTest);
+  FRIEND_TEST_ALL_PREFIXES(BraveVPNServiceTest, CachedHostnamesTest);
   FRIEND_TEST_ALL_PREFIXES(BraveVPNServiceTest, CancelConnectingTest);
   FRIEND_TEST_ALL_PREFIXES(BraveVPNServiceTest, ConnectionInfoTest);
   FRIEND_TEST_ALL_PREFIXES(BraveVPNServiceTest, LoadPurchasedStateTest);
@@ -117,6 +120,16 @@ class BraveVpnServiceDesktop
                         bool success);
   void ParseAndCacheHostnames(const std::string& region,
                               base::Value hostnames_value);
+  // Picks |hostname_| from the hostnames cached for |region| if they are
+  // fresh enough and refreshes the cache in the background.
+  bool PickHostnameFromCache(const std::string& region);
+  void OnRefreshHostnames(const std::string& region,
+                          const std::string& hostnames,
+                          bool success);
+  void CacheHostnames(const std::string& region,
+                      const base::Value& hostnames_value);
+  void FetchSubscriberCredential();
+  void RecordHostnameConnectTime(bool success);
   void SetDeviceRegion(const std::string& name);
   void SetFallbackDeviceRegion();
   void SetDeviceRegion(const brave_vpn::mojom::Region& region);
@@ -153,6 +166,10 @@ class BraveVpnServiceDesktop
   brave_vpn::mojom::Region device_region_;
   brave_vpn::mojom::Region selected_region_;
   std::unique_ptr<brave_vpn::Hostname> hostname_;
+  // How long the last connect to each hostname took. Failed connects are
+  // stored as base::TimeDelta::Max().
+  base::flat_map<std::string, base::TimeDelta> hostname_connect_times_;
+  base::TimeTicks connect_start_time_;
   brave_vpn::BraveVPNConnectionInfo connection_info_;
   bool cancel_connecting_ = false;
   PurchasedState purchased_state_ = PurchasedState::NOT_PURCHASED;
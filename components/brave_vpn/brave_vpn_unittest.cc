@@ -269,6 +269,22 @@ TEST_F(BraveVPNServiceTest, DISABLED_HostnamesTest) {
   EXPECT_FALSE(service_->hostname_);
 }
 
+TEST_F(BraveVPNServiceTest, DISABLED_CachedHostnamesTest) {
+  // Fetched hostnames are cached per region.
+  service_->OnFetchHostnames("region-a", GetHostnamesData(), true);
+  EXPECT_TRUE(
+      pref_service_.GetDictionary(brave_vpn::prefs::kBraveVPNHostnamesCache)
+          ->FindDictKey("region-a"));
+
+  // Cached hostnames are used without fetching again.
+  service_->hostname_.reset();
+  EXPECT_TRUE(service_->PickHostnameFromCache("region-a"));
+  EXPECT_EQ("host-2.brave.com", service_->hostname_->hostname);
+
+  // No cache for other regions.
+  EXPECT_FALSE(service_->PickHostnameFromCache("region-b"));
+}
+
 // TODO(bsclifton): fix after flow is decided
 TEST_F(BraveVPNServiceTest, DISABLED_LoadPurchasedStateTest) {
   EXPECT_EQ(PurchasedState::NOT_PURCHASED, service_->purchased_state_);
@@ -5,6 +5,9 @@
 
 #include "brave/components/brave_vpn/brave_vpn_utils.h"
 
+#include <algorithm>
+#include <iterator>
+
 #include "base/feature_list.h"
 #include "brave/components/brave_vpn/brave_vpn_constants.h"
 #include "brave/components/brave_vpn/features.h"
@@ -13,6 +16,14 @@
 
 namespace brave_vpn {
 
+namespace {
+
+// Hostnames we never connected to are ranked as if connecting took this long,
+// so they come after known fast hosts but before slow ones.
+constexpr base::TimeDelta kDefaultHostnameConnectTime = base::Seconds(10);
+
+}  // namespace
+
 bool IsBraveVPNEnabled() {
   return base::FeatureList::IsEnabled(brave_vpn::features::kBraveVPN) &&
          base::FeatureList::IsEnabled(skus::features::kSkusFeature);
@@ -31,4 +42,37 @@ std::string GetManageUrl() {
   return brave_vpn::kManageUrlProd;
 }
 
+std::unique_ptr<Hostname> PickBestHostname(
+    const std::vector<Hostname>& hostnames,
+    const base::flat_map<std::string, base::TimeDelta>& connect_times) {
+  std::vector<Hostname> filtered_hostnames;
+  std::copy_if(hostnames.begin(), hostnames.end(),
+               std::back_inserter(filtered_hostnames),
+               [](const Hostname& hostname) { return !hostname.is_offline; });
+
+  auto connect_time = [&connect_times](const Hostname& hostname) {
+    auto it = connect_times.find(hostname.hostname);
+    return it == connect_times.end() ? kDefaultHostnameConnectTime
+                                     : it->second;
+  };
+  std::stable_sort(
+      filtered_hostnames.begin(), filtered_hostnames.end(),
+      [&connect_time](const Hostname& a, const Hostname& b) {
+        // A failed host is unlikely to work on the next try either, whatever
+        // its capacity score.
+        const bool a_failed = connect_time(a) == base::TimeDelta::Max();
+        const bool b_failed = connect_time(b) == base::TimeDelta::Max();
+        if (a_failed != b_failed)
+          return b_failed;
+        if (a.capacity_score != b.capacity_score)
+          return a.capacity_score > b.capacity_score;
+        return connect_time(a) < connect_time(b);
+      });
+
+  if (filtered_hostnames.empty())
+    return std::make_unique<Hostname>();
+
+  return std::make_unique<Hostname>(filtered_hostnames[0]);
+}
+
 }  // namespace brave_vpn
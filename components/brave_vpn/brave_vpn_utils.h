@@ -6,13 +6,28 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_VPN_BRAVE_VPN_UTILS_H_
 #define BRAVE_COMPONENTS_BRAVE_VPN_BRAVE_VPN_UTILS_H_
 
+#include <memory>
 #include <string>
+#include <vector>
+
+#include "base/containers/flat_map.h"
+#include "base/time/time.h"
+#include "brave/components/brave_vpn/brave_vpn_data_types.h"
 
 namespace brave_vpn {
 
 bool IsBraveVPNEnabled();
 std::string GetManageUrl();
 
+// Picks the hostname to connect to among the online |hostnames|. Hosts whose
+// last connect failed, stored as base::TimeDelta::Max() in |connect_times|,
+// are only picked when there is no other host. Otherwise the highest
+// capacity score wins and ties go to the host that connected fastest.
+// Returns an empty Hostname if all hosts are offline.
+std::unique_ptr<Hostname> PickBestHostname(
+    const std::vector<Hostname>& hostnames,
+    const base::flat_map<std::string, base::TimeDelta>& connect_times);
+
 }  // namespace brave_vpn
 
 #endif  // BRAVE_COMPONENTS_BRAVE_VPN_BRAVE_VPN_UTILS_H_
@@ -0,0 +1,101 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_vpn/brave_vpn_utils.h"
+
+#include <string>
+#include <vector>
+
+#include "base/containers/flat_map.h"
+#include "base/time/time.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave_vpn {
+
+namespace {
+
+using ConnectTimes = base::flat_map<std::string, base::TimeDelta>;
+
+std::string PickBestHostnameForTesting(const std::vector<Hostname>& hostnames,
+                                       const ConnectTimes& connect_times) {
+  return PickBestHostname(hostnames, connect_times)->hostname;
+}
+
+}  // namespace
+
+TEST(BraveVPNUtilsTest, PickBestHostnameByCapacityScore) {
+  const std::vector<Hostname> hostnames = {
+      {"host-1.brave.com", "host-1", false, 0},
+      {"host-2.brave.com", "host-2", false, 2},
+      {"host-3.brave.com", "host-3", true, 3},
+      {"host-4.brave.com", "host-4", false, 1}};
+
+  // host-3 has the highest capacity score but is offline.
+  EXPECT_EQ("host-2.brave.com", PickBestHostnameForTesting(hostnames, {}));
+}
+
+TEST(BraveVPNUtilsTest, PickBestHostnameByConnectTime) {
+  const std::vector<Hostname> hostnames = {
+      {"host-1.brave.com", "host-1", false, 0},
+      {"host-2.brave.com", "host-2", false, 1},
+      {"host-5.brave.com", "host-5", false, 1}};
+
+  // host-2 and host-5 have the same capacity score. Prefer the host that
+  // connected faster.
+  EXPECT_EQ("host-5.brave.com",
+            PickBestHostnameForTesting(
+                hostnames, {{"host-2.brave.com", base::Seconds(20)},
+                            {"host-5.brave.com", base::Seconds(1)}}));
+
+  // Hosts we never connected to rank after fast hosts but before slow ones.
+  EXPECT_EQ("host-5.brave.com",
+            PickBestHostnameForTesting(
+                hostnames, {{"host-2.brave.com", base::Seconds(20)}}));
+  EXPECT_EQ("host-2.brave.com",
+            PickBestHostnameForTesting(
+                hostnames, {{"host-5.brave.com", base::Seconds(20)}}));
+
+  // A slow connect doesn't outweigh a higher capacity score.
+  EXPECT_EQ("host-2.brave.com",
+            PickBestHostnameForTesting(
+                hostnames, {{"host-1.brave.com", base::Seconds(1)},
+                            {"host-2.brave.com", base::Seconds(20)}}));
+}
+
+TEST(BraveVPNUtilsTest, PickBestHostnameDemotesFailedHosts) {
+  const std::vector<Hostname> hostnames = {
+      {"host-1.brave.com", "host-1", false, 0},
+      {"host-2.brave.com", "host-2", false, 2},
+      {"host-5.brave.com", "host-5", false, 1}};
+
+  // host-2 has the highest capacity score but failed to connect last time.
+  EXPECT_EQ("host-5.brave.com",
+            PickBestHostnameForTesting(
+                hostnames, {{"host-2.brave.com", base::TimeDelta::Max()}}));
+
+  // Failed hosts come after all other hosts, whatever their capacity score.
+  EXPECT_EQ("host-1.brave.com",
+            PickBestHostnameForTesting(
+                hostnames, {{"host-2.brave.com", base::TimeDelta::Max()},
+                            {"host-5.brave.com", base::TimeDelta::Max()}}));
+
+  // Failed hosts are still picked when there is no other host.
+  EXPECT_EQ("host-2.brave.com",
+            PickBestHostnameForTesting(
+                hostnames, {{"host-1.brave.com", base::TimeDelta::Max()},
+                            {"host-2.brave.com", base::TimeDelta::Max()},
+                            {"host-5.brave.com", base::TimeDelta::Max()}}));
+}
+
+TEST(BraveVPNUtilsTest, PickBestHostnameWithoutOnlineHosts) {
+  const std::vector<Hostname> hostnames = {
+      {"host-1.brave.com", "host-1", true, 0},
+      {"host-2.brave.com", "host-2", true, 1}};
+
+  EXPECT_TRUE(PickBestHostnameForTesting(hostnames, {}).empty());
+  EXPECT_TRUE(PickBestHostnameForTesting({}, {}).empty());
+}
+
+}  // namespace brave_vpn
@@ -15,6 +15,7 @@ void RegisterProfilePrefs(PrefRegistrySimple* registry) {
   registry->RegisterDictionaryPref(kBraveVPNSelectedRegion);
   registry->RegisterListPref(kBraveVPNRegionList);
   registry->RegisterDictionaryPref(kBraveVPNDeviceRegion);
+  registry->RegisterDictionaryPref(kBraveVPNHostnamesCache);
 }
 
 }  // namespace prefs
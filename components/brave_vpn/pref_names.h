@@ -15,6 +15,7 @@ constexpr char kBraveVPNSelectedRegion[] = "brave.brave_vpn.selected_region";
 constexpr char kBraveVPNShowButton[] = "brave.brave_vpn.show_button";
 constexpr char kBraveVPNRegionList[] = "brave.brave_vpn.region_list";
 constexpr char kBraveVPNDeviceRegion[] = "brave.brave_vpn.device_region";
+constexpr char kBraveVPNHostnamesCache[] = "brave.brave_vpn.hostnames_cache";
 
 void RegisterProfilePrefs(PrefRegistrySimple* registry);
 
@@ -8,11 +8,18 @@
 #include <algorithm>
 #include <utility>
 
+#include "base/strings/string_util.h"
 #include "base/strings/stringprintf.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
 
 namespace brave_wallet {
 
+BlockchainRegistry::TokenIndex::TokenIndex() = default;
+BlockchainRegistry::TokenIndex::TokenIndex(TokenIndex&&) = default;
+BlockchainRegistry::TokenIndex& BlockchainRegistry::TokenIndex::operator=(
+    TokenIndex&&) = default;
+BlockchainRegistry::TokenIndex::~TokenIndex() = default;
+
 BlockchainRegistry::BlockchainRegistry() = default;
 
 BlockchainRegistry::~BlockchainRegistry() {}
@@ -35,6 +42,27 @@ void BlockchainRegistry::Bind(
 
 void BlockchainRegistry::UpdateTokenList(TokenListMap token_list_map) {
   token_list_map_ = std::move(token_list_map);
+
+  // Wallet panels resolve a token for every balance they show, so build the
+  // lookup tables once per list update instead of scanning on each call.
+  token_indexes_.clear();
+  for (const auto& chain_tokens : token_list_map_) {
+    std::vector<TokenIndex::TokenMap::value_type> by_contract;
+    std::vector<TokenIndex::TokenMap::value_type> by_symbol;
+    by_contract.reserve(chain_tokens.second.size());
+    by_symbol.reserve(chain_tokens.second.size());
+    for (const auto& token : chain_tokens.second) {
+      by_contract.emplace_back(base::ToLowerASCII(token->contract_address),
+                               token.get());
+      by_symbol.emplace_back(token->symbol, token.get());
+    }
+
+    // flat_map keeps the first of duplicate keys, which matches the order
+    // the lists were previously searched in.
+    TokenIndex& index = token_indexes_[chain_tokens.first];
+    index.by_contract = TokenIndex::TokenMap(std::move(by_contract));
+    index.by_symbol = TokenIndex::TokenMap(std::move(by_symbol));
+  }
 }
 
 void BlockchainRegistry::GetTokenByContract(
@@ -47,48 +75,43 @@ void BlockchainRegistry::GetTokenByContract(
 mojom::BlockchainTokenPtr BlockchainRegistry::GetTokenByContract(
     const std::string& chain_id,
     const std::string& contract) {
-  if (token_list_map_.find(chain_id) == token_list_map_.end())
+  auto index_it = token_indexes_.find(chain_id);
+  if (index_it == token_indexes_.end())
     return nullptr;
 
-  const auto& tokens = token_list_map_[chain_id];
-  auto token_it =
-      std::find_if(tokens.begin(), tokens.end(),
-                   [&](const mojom::BlockchainTokenPtr& current_token) {
-                     return current_token->contract_address == contract;
-                   });
-  return token_it == tokens.end() ? nullptr : token_it->Clone();
+  const auto& by_contract = index_it->second.by_contract;
+  auto token_it = by_contract.find(base::ToLowerASCII(contract));
+  return token_it == by_contract.end() ? nullptr : token_it->second->Clone();
 }
 
 void BlockchainRegistry::GetTokenBySymbol(const std::string& chain_id,
                                           const std::string& symbol,
                                           GetTokenBySymbolCallback callback) {
-  if (token_list_map_.find(chain_id) == token_list_map_.end()) {
+  auto index_it = token_indexes_.find(chain_id);
+  if (index_it == token_indexes_.end()) {
     std::move(callback).Run(nullptr);
     return;
   }
-  const auto& tokens = token_list_map_[chain_id];
-  auto token_it =
-      std::find_if(tokens.begin(), tokens.end(),
-                   [&](const mojom::BlockchainTokenPtr& current_token) {
-                     return current_token->symbol == symbol;
-                   });
-
-  if (token_it == tokens.end()) {
+
+  const auto& by_symbol = index_it->second.by_symbol;
+  auto token_it = by_symbol.find(symbol);
+  if (token_it == by_symbol.end()) {
     std::move(callback).Run(nullptr);
     return;
   }
 
-  std::move(callback).Run(token_it->Clone());
+  std::move(callback).Run(token_it->second->Clone());
 }
 
 void BlockchainRegistry::GetAllTokens(const std::string& chain_id,
                                       GetAllTokensCallback callback) {
-  if (token_list_map_.find(chain_id) == token_list_map_.end()) {
+  auto tokens_it = token_list_map_.find(chain_id);
+  if (tokens_it == token_list_map_.end()) {
     std::move(callback).Run(
         std::vector<brave_wallet::mojom::BlockchainTokenPtr>());
     return;
   }
-  const auto& tokens = token_list_map_[chain_id];
+  const auto& tokens = tokens_it->second;
   std::vector<brave_wallet::mojom::BlockchainTokenPtr> tokens_copy(
       tokens.size());
   std::transform(
@@ -6,9 +6,11 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_BLOCKCHAIN_REGISTRY_H_
 #define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_BLOCKCHAIN_REGISTRY_H_
 
+#include <map>
 #include <string>
 #include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/memory/singleton.h"
 #include "brave/components/brave_wallet/browser/blockchain_list_parser.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
@@ -61,6 +63,23 @@ class BlockchainRegistry : public mojom::BlockchainRegistry {
   BlockchainRegistry();
 
  private:
+  // Lookup tables into the tokens owned by |token_list_map_|, rebuilt by
+  // UpdateTokenList().
+  struct TokenIndex {
+    using TokenMap =
+        base::flat_map<std::string, const mojom::BlockchainToken*>;
+
+    TokenIndex();
+    TokenIndex(TokenIndex&&);
+    TokenIndex& operator=(TokenIndex&&);
+    ~TokenIndex();
+
+    // Keyed by lowercase contract address.
+    TokenMap by_contract;
+    TokenMap by_symbol;
+  };
+
+  std::map<std::string, TokenIndex> token_indexes_;
   mojo::ReceiverSet<mojom::BlockchainRegistry> receivers_;
 };
 
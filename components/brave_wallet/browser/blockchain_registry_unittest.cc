@@ -146,6 +146,14 @@ TEST(BlockchainRegistryUnitTest, GetTokenByContract) {
       }));
   run_loop2.Run();
 
+  // Contract addresses are matched case insensitively
+  EXPECT_EQ(registry
+                ->GetTokenByContract(
+                    mojom::kMainnetChainId,
+                    "0x0d8775f648430679a709e98d2b0cb6250d2887ef")
+                ->symbol,
+            "BAT");
+
   // tokens for chanId exist but contract doesn't exist
   base::RunLoop run_loop3;
   registry->GetTokenByContract(
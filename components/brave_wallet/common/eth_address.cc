@@ -38,7 +38,7 @@ EthAddress EthAddress::FromPublicKey(const std::vector<uint8_t>& public_key) {
     return EthAddress();
   }
 
-  std::vector<uint8_t> hash = KeccakHash(public_key);
+  const auto hash = KeccakHashToArray(public_key);
   std::vector<uint8_t> result(hash.end() - ADDRESS_LEN, hash.end());
 
   DCHECK(result.size() == ADDRESS_LEN);
@@ -74,12 +74,10 @@ bool EthAddress::IsValidAddress(const std::string& input) {
 }
 
 std::string EthAddress::ToHex() const {
-  const std::string input(bytes_.begin(), bytes_.end());
-  return ::brave_wallet::ToHex(input);
+  return ::brave_wallet::ToHex(bytes_);
 }
 
 std::string EthAddress::ToChecksumAddress(uint256_t eip1191_chaincode) const {
-  std::string result = "0x";
   std::string input;
 
   if (eip1191_chaincode == static_cast<uint256_t>(30) ||
@@ -90,23 +88,22 @@ std::string EthAddress::ToChecksumAddress(uint256_t eip1191_chaincode) const {
         base::NumberToString(static_cast<uint64_t>(eip1191_chaincode)) + "0x";
   }
 
-  input += std::string(ToHex().data() + 2);
-
-  const std::string hash_str(KeccakHash(input).data() + 2);
-  const std::string address_str =
-      base::ToLowerASCII(base::HexEncode(bytes_.data(), bytes_.size()));
-
-  for (size_t i = 0; i < address_str.length(); ++i) {
-    if (isdigit(address_str[i])) {
-      result.push_back(address_str[i]);
-    } else {  // address has already be validated
-      int nibble = std::stoi(std::string(1, hash_str[i]), nullptr, 16);
-      if (nibble > 7) {
-        result.push_back(base::ToUpperASCII(address_str[i]));
-      } else {
-        result.push_back(address_str[i]);
-      }
-    }
+  const size_t address_offset = input.length();
+  AppendLowerHex(bytes_, &input);
+  const auto hash = KeccakHashToArray(base::as_bytes(base::make_span(input)));
+
+  std::string result;
+  result.reserve(2 + input.length() - address_offset);
+  result.append("0x");
+  for (size_t i = address_offset; i < input.length(); ++i) {
+    // Each hex digit of the address is checked against the nibble of the hash
+    // at the same position.
+    const size_t nibble_index = i - address_offset;
+    const uint8_t nibble = nibble_index % 2
+                               ? hash[nibble_index / 2] & 0x0F
+                               : hash[nibble_index / 2] >> 4;
+    // address has already be validated
+    result.push_back(nibble > 7 ? base::ToUpperASCII(input[i]) : input[i]);
   }
   return result;
 }
@@ -38,9 +38,10 @@ EthSignTypedDataHelper::EthSignTypedDataHelper(const base::Value& types,
 EthSignTypedDataHelper::~EthSignTypedDataHelper() = default;
 
 bool EthSignTypedDataHelper::SetTypes(const base::Value& types) {
-  if (!types_.is_dict())
+  if (!types.is_dict())
     return false;
   types_ = types.Clone();
+  type_hashes_.clear();
   return true;
 }
 
@@ -49,7 +50,7 @@ void EthSignTypedDataHelper::SetVersion(Version version) {
 }
 
 void EthSignTypedDataHelper::FindAllDependencyTypes(
-    base::flat_map<std::string, base::Value>* known_types,
+    base::flat_map<std::string, const base::Value*>* known_types,
     const std::string& anchor_type_name) const {
   DCHECK(!anchor_type_name.empty());
   DCHECK(known_types);
@@ -58,7 +59,7 @@ void EthSignTypedDataHelper::FindAllDependencyTypes(
       types_.FindKeyOfType(anchor_type_name, base::Value::Type::LIST);
   if (!anchor_type)
     return;
-  known_types->emplace(anchor_type_name, anchor_type->Clone());
+  known_types->emplace(anchor_type_name, anchor_type);
 
   for (const auto& field : anchor_type->GetList()) {
     const std::string* type = field.FindStringKey("type");
@@ -91,26 +92,34 @@ std::string EthSignTypedDataHelper::EncodeTypes(
     const std::string& primary_type_name) const {
   std::string result;
 
-  base::flat_map<std::string, base::Value> types_map;
+  base::flat_map<std::string, const base::Value*> types_map;
   FindAllDependencyTypes(&types_map, primary_type_name);
 
   auto it = types_map.find(primary_type_name);
   if (it != types_map.end()) {
-    base::StrAppend(&result, {EncodeType(it->second, primary_type_name)});
+    base::StrAppend(&result, {EncodeType(*it->second, primary_type_name)});
   }
   for (const auto& type : types_map) {
     if (type.first == primary_type_name)
       continue;
-    base::StrAppend(&result, {EncodeType(type.second, type.first)});
+    base::StrAppend(&result, {EncodeType(*type.second, type.first)});
   }
   return result;
 }
 
 std::vector<uint8_t> EthSignTypedDataHelper::GetTypeHash(
     const std::string primary_type_name) const {
-  const std::string type_hash =
-      KeccakHash(EncodeTypes(primary_type_name), false);
-  return std::vector<uint8_t>(type_hash.begin(), type_hash.end());
+  auto it = type_hashes_.find(primary_type_name);
+  if (it != type_hashes_.end())
+    return it->second;
+
+  const std::string encoded_types = EncodeTypes(primary_type_name);
+  const auto type_hash =
+      KeccakHashToArray(base::as_bytes(base::make_span(encoded_types)));
+  return type_hashes_
+      .emplace(primary_type_name,
+               std::vector<uint8_t>(type_hash.begin(), type_hash.end()))
+      .first->second;
 }
 
 absl::optional<std::vector<uint8_t>> EthSignTypedDataHelper::HashStruct(
@@ -130,6 +139,7 @@ absl::optional<std::vector<uint8_t>> EthSignTypedDataHelper::EncodeData(
   DCHECK(primary_type);
   DCHECK(primary_type->is_list());
   std::vector<uint8_t> result;
+  result.reserve(32 * (primary_type->GetList().size() + 1));
 
   const std::vector<uint8_t> type_hash = GetTypeHash(primary_type_name);
   result.insert(result.end(), type_hash.begin(), type_hash.end());
@@ -181,17 +191,15 @@ absl::optional<std::vector<uint8_t>> EthSignTypedDataHelper::EncodeField(
       array_result.insert(array_result.end(), encoded_item->begin(),
                           encoded_item->end());
     }
-    auto array_hash = KeccakHash(array_result);
+    const auto array_hash = KeccakHashToArray(array_result);
     result.insert(result.end(), array_hash.begin(), array_hash.end());
   } else if (type == "string") {
     const std::string* value_str = value.GetIfString();
     if (!value_str)
       return absl::nullopt;
-    const std::string encoded_value = KeccakHash(*value_str, false);
-    const std::vector<uint8_t> encoded_value_bytes(encoded_value.begin(),
-                                                   encoded_value.end());
-    result.insert(result.end(), encoded_value_bytes.begin(),
-                  encoded_value_bytes.end());
+    const auto encoded_value =
+        KeccakHashToArray(base::as_bytes(base::make_span(*value_str)));
+    result.insert(result.end(), encoded_value.begin(), encoded_value.end());
   } else if (type == "bytes") {
     const std::string* value_str = value.GetIfString();
     if (!value_str || (!value_str->empty() && !IsValidHexString(*value_str)))
@@ -199,7 +207,7 @@ absl::optional<std::vector<uint8_t>> EthSignTypedDataHelper::EncodeField(
     std::vector<uint8_t> bytes;
     if (!value_str->empty())
       CHECK(PrefixedHexStringToBytes(*value_str, &bytes));
-    const std::vector<uint8_t> encoded_value = KeccakHash(bytes);
+    const auto encoded_value = KeccakHashToArray(bytes);
     result.insert(result.end(), encoded_value.begin(), encoded_value.end());
   } else if (type == "bool") {
     absl::optional<bool> value_bool = value.GetIfBool();
@@ -353,7 +361,7 @@ absl::optional<std::vector<uint8_t>> EthSignTypedDataHelper::EncodeField(
     auto encoded_data = EncodeData(type, value);
     if (!encoded_data)
       return absl::nullopt;
-    std::vector<uint8_t> encoded_value = KeccakHash(*encoded_data);
+    const auto encoded_value = KeccakHashToArray(*encoded_data);
 
     result.insert(result.end(), encoded_value.begin(), encoded_value.end());
   }
@@ -52,11 +52,12 @@ class EthSignTypedDataHelper {
  private:
   FRIEND_TEST_ALL_PREFIXES(EthSignedTypedDataHelperUnitTest, Types);
   FRIEND_TEST_ALL_PREFIXES(EthSignedTypedDataHelperUnitTest, EncodeField);
+  FRIEND_TEST_ALL_PREFIXES(EthSignedTypedDataHelperUnitTest, TypeHashCache);
 
   explicit EthSignTypedDataHelper(const base::Value& types, Version version);
 
   void FindAllDependencyTypes(
-      base::flat_map<std::string, base::Value>* known_types,
+      base::flat_map<std::string, const base::Value*>* known_types,
       const std::string& anchor_type_name) const;
   std::string EncodeType(const base::Value& type,
                          const std::string& type_name) const;
@@ -68,6 +69,9 @@ class EthSignTypedDataHelper {
 
   base::Value types_;
   Version version_;
+  // Type hashes only depend on |types_|, so each one is computed once and
+  // reused for every struct of that type in the data.
+  mutable base::flat_map<std::string, std::vector<uint8_t>> type_hashes_;
 };
 
 }  // namespace brave_wallet
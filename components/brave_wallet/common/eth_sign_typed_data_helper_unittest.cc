@@ -7,10 +7,12 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "base/json/json_reader.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/string_util.h"
+#include "brave/components/brave_wallet/common/hash_utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
 namespace brave_wallet {
@@ -52,6 +54,46 @@ TEST(EthSignedTypedDataHelperUnitTest, Types) {
   EXPECT_EQ(typed_hash_v3, typed_hash_v4);
 }
 
+TEST(EthSignedTypedDataHelperUnitTest, TypeHashCache) {
+  auto types_value = base::JSONReader::Read(R"({
+    "Mail": [
+        {"name": "from", "type": "Person"},
+        {"name": "to", "type": "Person"},
+        {"name": "contents", "type": "string"}
+    ],
+    "Person": [
+        {"name": "name", "type": "string"},
+        {"name": "wallet", "type": "address"}
+    ]})");
+  ASSERT_TRUE(types_value);
+
+  std::unique_ptr<EthSignTypedDataHelper> helper =
+      EthSignTypedDataHelper::Create(*types_value,
+                                     EthSignTypedDataHelper::Version::kV4);
+  ASSERT_TRUE(helper);
+  const auto mail_hash = helper->GetTypeHash("Mail");
+  EXPECT_EQ(mail_hash, helper->GetTypeHash("Mail"));
+  EXPECT_EQ(1u, helper->type_hashes_.size());
+
+  // Each type name gets its own entry.
+  helper->GetTypeHash("Person");
+  EXPECT_EQ(2u, helper->type_hashes_.size());
+
+  // Changing the types drops the cached hashes.
+  auto new_types_value = base::JSONReader::Read(R"({
+    "Mail": [
+        {"name": "contents", "type": "string"}
+    ]})");
+  ASSERT_TRUE(new_types_value);
+  ASSERT_TRUE(helper->SetTypes(*new_types_value));
+  EXPECT_TRUE(helper->type_hashes_.empty());
+  const std::string new_mail_hash = KeccakHash("Mail(string contents)", false);
+  EXPECT_EQ(helper->GetTypeHash("Mail"),
+            std::vector<uint8_t>(new_mail_hash.begin(), new_mail_hash.end()));
+
+  EXPECT_FALSE(helper->SetTypes(base::Value("not a dict")));
+}
+
 TEST(EthSignedTypedDataHelperUnitTest, EncodedData) {
   const std::string types_json(R"({
     "Mail": [
@@ -6,7 +6,9 @@
 #include "brave/components/brave_wallet/common/hash_utils.h"
 
 #include <algorithm>
+#include <iterator>
 
+#include "base/strings/string_piece.h"
 #include "base/strings/string_split.h"
 #include "brave/components/brave_wallet/common/hex_utils.h"
 #include "brave/third_party/ethash/src/include/ethash/keccak.h"
@@ -14,33 +16,44 @@
 namespace brave_wallet {
 
 std::string KeccakHash(const std::string& input, bool to_hex) {
-  std::vector<uint8_t> bytes(input.begin(), input.end());
-  std::vector<uint8_t> result = KeccakHash(bytes);
-  std::string result_str(result.begin(), result.end());
-  return to_hex ? ToHex(result_str) : result_str;
+  const auto hash = KeccakHashToArray(base::as_bytes(base::make_span(input)));
+  return to_hex ? ToHex(hash) : std::string(hash.begin(), hash.end());
 }
 
 std::vector<uint8_t> KeccakHash(const std::vector<uint8_t>& input) {
-  auto hash = ethash_keccak256(input.data(), input.size());
-  return std::vector<uint8_t>(hash.bytes, hash.bytes + 32);
+  const auto hash = KeccakHashToArray(input);
+  return std::vector<uint8_t>(hash.begin(), hash.end());
+}
+
+std::array<uint8_t, kKeccakHashLength> KeccakHashToArray(
+    base::span<const uint8_t> input) {
+  const auto hash = ethash_keccak256(input.data(), input.size());
+  std::array<uint8_t, kKeccakHashLength> result;
+  std::copy(std::begin(hash.bytes), std::end(hash.bytes), result.begin());
+  return result;
 }
 
 std::string GetFunctionHash(const std::string& input) {
-  std::string result = KeccakHash(input);
-  return result.substr(0, std::min(static_cast<size_t>(10), result.length()));
+  const auto hash = KeccakHashToArray(base::as_bytes(base::make_span(input)));
+  return ToHex(base::make_span(hash).first(4));
 }
 
 std::string Namehash(const std::string& name) {
-  std::string hash(32, '\0');
-  std::vector<std::string> labels =
-      SplitString(name, ".", base::KEEP_WHITESPACE, base::SPLIT_WANT_NONEMPTY);
+  // Holds the current node hash followed by the hash of the next label.
+  std::array<uint8_t, kKeccakHashLength * 2> buffer = {};
+  const auto node = base::make_span(buffer).first<kKeccakHashLength>();
+  const auto label_hash = base::make_span(buffer).last<kKeccakHashLength>();
+  std::vector<base::StringPiece> labels = base::SplitStringPiece(
+      name, ".", base::KEEP_WHITESPACE, base::SPLIT_WANT_NONEMPTY);
 
   for (auto rit = labels.rbegin(); rit != labels.rend(); rit++) {
-    std::string label_hash = KeccakHash(*rit, false);
-    hash = KeccakHash(hash + label_hash, false);
+    const auto hash = KeccakHashToArray(base::as_bytes(base::make_span(*rit)));
+    std::copy(hash.begin(), hash.end(), label_hash.begin());
+    const auto new_node = KeccakHashToArray(buffer);
+    std::copy(new_node.begin(), new_node.end(), node.begin());
   }
 
-  return ToHex(hash);
+  return ToHex(node);
 }
 
 }  // namespace brave_wallet
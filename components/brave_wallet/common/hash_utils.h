@@ -6,14 +6,22 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_WALLET_COMMON_HASH_UTILS_H_
 #define BRAVE_COMPONENTS_BRAVE_WALLET_COMMON_HASH_UTILS_H_
 
+#include <array>
 #include <string>
 #include <vector>
 
+#include "base/containers/span.h"
+
 namespace brave_wallet {
 
+constexpr size_t kKeccakHashLength = 32;
+
 // Equivalent to web3.utils.keccak256(string)
 std::string KeccakHash(const std::string& input, bool to_hex = true);
 std::vector<uint8_t> KeccakHash(const std::vector<uint8_t>& input);
+// Same as above but doesn't allocate, for use in loops.
+std::array<uint8_t, kKeccakHashLength> KeccakHashToArray(
+    base::span<const uint8_t> input);
 
 // Returns the hex encoding of the first 4 bytes of the hash.
 // For example: keccak('balanceOf(address)')
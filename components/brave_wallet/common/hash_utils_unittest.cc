@@ -5,8 +5,10 @@
 
 #include "brave/components/brave_wallet/common/hash_utils.h"
 
+#include <string>
 #include <vector>
 
+#include "brave/components/brave_wallet/common/hex_utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
 namespace brave_wallet {
@@ -20,6 +22,16 @@ TEST(HashUtilsUnitTest, KeccakHash) {
       "0x47173285a8d7341e5e972fc677286384f802f8ef42a5ec5f03bbfa254cb01fad");
 }
 
+TEST(HashUtilsUnitTest, KeccakHashToArray) {
+  const std::string input = "hello world";
+  const auto hash = KeccakHashToArray(base::as_bytes(base::make_span(input)));
+  EXPECT_EQ(
+      ToHex(hash),
+      "0x47173285a8d7341e5e972fc677286384f802f8ef42a5ec5f03bbfa254cb01fad");
+  const std::vector<uint8_t> bytes(input.begin(), input.end());
+  EXPECT_EQ(std::vector<uint8_t>(hash.begin(), hash.end()), KeccakHash(bytes));
+}
+
 TEST(HashUtilsUnitTest, GetFunctionHash) {
   ASSERT_EQ(GetFunctionHash("transfer(address,uint256)"), "0xa9059cbb");
   ASSERT_EQ(GetFunctionHash("approve(address,uint256)"), "0x095ea7b3");
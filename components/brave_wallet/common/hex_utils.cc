@@ -7,6 +7,8 @@
 
 #include <limits>
 
+#include "base/check.h"
+#include "base/strings/strcat.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/string_util.h"
 #include "base/strings/stringprintf.h"
@@ -14,16 +16,30 @@
 namespace brave_wallet {
 
 std::string ToHex(const std::string& data) {
-  if (data.empty()) {
-    return "0x0";
-  }
-  return "0x" + base::ToLowerASCII(base::HexEncode(data.data(), data.size()));
+  return ToHex(base::as_bytes(base::make_span(data)));
 }
 
 std::string ToHex(const std::vector<uint8_t>& data) {
+  return ToHex(base::make_span(data));
+}
+
+std::string ToHex(base::span<const uint8_t> data) {
   if (data.empty())
     return "0x0";
-  return "0x" + base::ToLowerASCII(base::HexEncode(data));
+  std::string result;
+  result.reserve(2 + data.size() * 2);
+  result.append("0x");
+  AppendLowerHex(data, &result);
+  return result;
+}
+
+void AppendLowerHex(base::span<const uint8_t> data, std::string* out) {
+  DCHECK(out);
+  static constexpr char kHexChars[] = "0123456789abcdef";
+  for (uint8_t byte : data) {
+    out->push_back(kHexChars[byte >> 4]);
+    out->push_back(kHexChars[byte & 0x0F]);
+  }
 }
 
 // Determines if the passed in hex string is valid
@@ -34,8 +50,8 @@ bool IsValidHexString(const std::string& hex_input) {
   if (!base::StartsWith(hex_input, "0x")) {
     return false;
   }
-  for (const auto& c : hex_input.substr(2)) {
-    if (!base::IsHexDigit(c)) {
+  for (size_t i = 2; i < hex_input.length(); ++i) {
+    if (!base::IsHexDigit(hex_input[i])) {
       return false;
     }
   }
@@ -110,7 +126,7 @@ bool HexValueToUint256(const std::string& hex_input, uint256_t* out) {
   }
   *out = 0;
   uint256_t last_val = 0;  // Used to check overflows
-  for (char c : hex_input.substr(2)) {
+  for (char c : base::StringPiece(hex_input).substr(2)) {
     (*out) <<= 4;
     (*out) += static_cast<uint256_t>(base::HexDigitToInt(c));
     if (last_val > *out) {
@@ -161,12 +177,10 @@ bool PrefixedHexStringToBytes(const std::string& input,
     DCHECK_EQ(input, "0x");
     return true;
   }
-  std::string hex_substr = input.substr(2);
+  const base::StringPiece hex_substr = base::StringPiece(input).substr(2);
   if (hex_substr.length() % 2 == 1)
-    hex_substr = "0" + hex_substr;
-  if (!base::HexStringToBytes(hex_substr, bytes))
-    return false;
-  return true;
+    return base::HexStringToBytes(base::StrCat({"0", hex_substr}), bytes);
+  return base::HexStringToBytes(hex_substr, bytes);
 }
 
 }  // namespace brave_wallet
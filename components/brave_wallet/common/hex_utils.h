@@ -9,6 +9,7 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/span.h"
 #include "brave/components/brave_wallet/common/brave_wallet_types.h"
 
 namespace brave_wallet {
@@ -16,6 +17,9 @@ namespace brave_wallet {
 // Equivalent to web3.utils.toHex(string);
 std::string ToHex(const std::string& data);
 std::string ToHex(const std::vector<uint8_t>& data);
+std::string ToHex(base::span<const uint8_t> data);
+// Appends the lowercase hex encoding of |data| to |out|, without a 0x prefix.
+void AppendLowerHex(base::span<const uint8_t> data, std::string* out);
 // Determines if the passed in hex string is valid
 bool IsValidHexString(const std::string& hex_input);
 
@@ -21,6 +21,19 @@ TEST(HexUtilsUnitTest, ToHex) {
   const std::string str1("hello world");
   ASSERT_EQ(ToHex(std::vector<uint8_t>(str1.begin(), str1.end())),
             "0x68656c6c6f20776f726c64");
+
+  const uint8_t bytes[] = {0x00, 0x0f, 0xab, 0xff};
+  ASSERT_EQ(ToHex(base::span<const uint8_t>()), "0x0");
+  ASSERT_EQ(ToHex(bytes), "0x000fabff");
+}
+
+TEST(HexUtilsUnitTest, AppendLowerHex) {
+  std::string out = "0x";
+  const uint8_t bytes[] = {0x00, 0x0f, 0xAB, 0xFF};
+  AppendLowerHex(bytes, &out);
+  EXPECT_EQ(out, "0x000fabff");
+  AppendLowerHex(base::span<const uint8_t>(), &out);
+  EXPECT_EQ(out, "0x000fabff");
 }
 
 TEST(HexUtilsUnitTest, IsValidHexString) {
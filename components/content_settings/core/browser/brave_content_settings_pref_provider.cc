@@ -457,9 +457,13 @@ std::unique_ptr<RuleIterator> BravePrefProvider::GetRuleIterator(
 void BravePrefProvider::UpdateCookieRules(ContentSettingsType content_type,
                                           bool incognito) {
   std::vector<Rule> rules;
-  auto old_rules = std::move(brave_cookie_rules_[incognito]);
-
-  brave_cookie_rules_[incognito].clear();
+  std::vector<std::pair<RulePatterns, ContentSetting>> brave_rules;
+  auto add_brave_rule = [&rules, &brave_rules](Rule rule) {
+    brave_rules.emplace_back(
+        RulePatterns(rule.primary_pattern, rule.secondary_pattern),
+        ValueToContentSetting(rule.value));
+    rules.push_back(std::move(rule));
+  };
 
   // kGoogleLoginControlType preference adds an exception for
   // accounts.google.com to access cookies in 3p context to allow login using
@@ -475,21 +479,16 @@ void BravePrefProvider::UpdateCookieRules(ContentSettingsType content_type,
   // PS: kGoogleLoginControlType preference might not be registered for tests.
   if (prefs_->FindPreference(kGoogleLoginControlType) &&
       prefs_->GetBoolean(kGoogleLoginControlType)) {
-    const auto google_auth_rule =
+    add_brave_rule(
         Rule(ContentSettingsPattern::FromString(kGoogleAuthPattern),
              ContentSettingsPattern::Wildcard(),
              ContentSettingToValue(CONTENT_SETTING_ALLOW), base::Time(),
-             SessionModel::Durable);
-    rules.emplace_back(CloneRule(google_auth_rule));
-    brave_cookie_rules_[incognito].emplace_back(CloneRule(google_auth_rule));
-
-    const auto firebase_rule =
+             SessionModel::Durable));
+    add_brave_rule(
         Rule(ContentSettingsPattern::FromString(kFirebasePattern),
              ContentSettingsPattern::Wildcard(),
              ContentSettingToValue(CONTENT_SETTING_ALLOW), base::Time(),
-             SessionModel::Durable);
-    rules.emplace_back(CloneRule(firebase_rule));
-    brave_cookie_rules_[incognito].emplace_back(CloneRule(firebase_rule));
+             SessionModel::Durable));
   }
   // non-pref based exceptions should go in the cookie_settings_base.cc
   // chromium_src override
@@ -520,10 +519,8 @@ void BravePrefProvider::UpdateCookieRules(ContentSettingsType content_type,
     // Matching cookie rules against shield rules.
     while (brave_cookies_iterator && brave_cookies_iterator->HasNext()) {
       auto rule = brave_cookies_iterator->Next();
-      if (IsActive(rule, shield_rules)) {
-        rules.emplace_back(CloneRule(rule, true));
-        brave_cookie_rules_[incognito].emplace_back(CloneRule(rule, true));
-      }
+      if (IsActive(rule, shield_rules))
+        add_brave_rule(CloneRule(rule, true));
     }
   }
 
@@ -535,53 +532,19 @@ void BravePrefProvider::UpdateCookieRules(ContentSettingsType content_type,
 
     // Shields down.
     if (ValueToContentSetting(shield_rule.value) == CONTENT_SETTING_BLOCK) {
-      rules.emplace_back(Rule(ContentSettingsPattern::Wildcard(),
-                              shield_rule.primary_pattern,
-                              ContentSettingToValue(CONTENT_SETTING_ALLOW),
-                              base::Time(), SessionModel::Durable));
-      brave_cookie_rules_[incognito].emplace_back(
-          Rule(ContentSettingsPattern::Wildcard(), shield_rule.primary_pattern,
-               ContentSettingToValue(CONTENT_SETTING_ALLOW), base::Time(),
-               SessionModel::Durable));
+      add_brave_rule(Rule(ContentSettingsPattern::Wildcard(),
+                          shield_rule.primary_pattern,
+                          ContentSettingToValue(CONTENT_SETTING_ALLOW),
+                          base::Time(), SessionModel::Durable));
     }
   }
 
   // get the list of changes
-  std::vector<Rule> brave_cookie_updates;
-  for (const auto& new_rule : brave_cookie_rules_[incognito]) {
-    auto match = std::find_if(
-        old_rules.begin(),
-        old_rules.end(),
-        [&new_rule](const auto& old_rule) {
-          // we want an exact match here because any change to the rule
-          // is an update
-          return new_rule.primary_pattern == old_rule.primary_pattern &&
-                 new_rule.secondary_pattern == old_rule.secondary_pattern &&
-                 ValueToContentSetting(new_rule.value) ==
-                     ValueToContentSetting(old_rule.value);
-        });
-    if (match == old_rules.end()) {
-      brave_cookie_updates.emplace_back(CloneRule(new_rule));
-    }
-  }
-
-  // find any removed rules
-  for (const auto& old_rule : old_rules) {
-    auto match = std::find_if(
-        brave_cookie_rules_[incognito].begin(),
-        brave_cookie_rules_[incognito].end(),
-        [&old_rule](const auto& new_rule) {
-          // we only care about the patterns here because we're looking
-          // for deleted rules, not changed rules
-          return new_rule.primary_pattern == old_rule.primary_pattern &&
-                 new_rule.secondary_pattern == old_rule.secondary_pattern;
-        });
-    if (match == brave_cookie_rules_[incognito].end()) {
-      brave_cookie_updates.emplace_back(
-          Rule(old_rule.primary_pattern, old_rule.secondary_pattern,
-               base::Value(), old_rule.expiration, old_rule.session_model));
-    }
-  }
+  CookieRuleSettings new_brave_rules(std::move(brave_rules));
+  std::vector<RulePatterns> brave_cookie_updates =
+      GetChangedCookieRulePatterns(brave_cookie_rules_[incognito],
+                                   new_brave_rules);
+  brave_cookie_rules_[incognito] = std::move(new_brave_rules);
 
   {
     base::AutoLock auto_lock(lock_);
@@ -601,11 +564,42 @@ void BravePrefProvider::UpdateCookieRules(ContentSettingsType content_type,
   }
 }
 
-void BravePrefProvider::NotifyChanges(const std::vector<Rule>& rules,
-                                      bool incognito) {
-  for (const auto& rule : rules) {
-    Notify(rule.primary_pattern, rule.secondary_pattern,
-           ContentSettingsType::COOKIES);
+// static
+std::vector<BravePrefProvider::RulePatterns>
+BravePrefProvider::GetChangedCookieRulePatterns(
+    const CookieRuleSettings& old_rules,
+    const CookieRuleSettings& new_rules) {
+  // Both maps are sorted by patterns, so a single merge pass finds every
+  // added, removed and changed rule.
+  std::vector<RulePatterns> changes;
+  auto old_it = old_rules.begin();
+  auto new_it = new_rules.begin();
+  while (old_it != old_rules.end() || new_it != new_rules.end()) {
+    if (new_it == new_rules.end() ||
+        (old_it != old_rules.end() && old_it->first < new_it->first)) {
+      // removed rule
+      changes.push_back(old_it->first);
+      ++old_it;
+    } else if (old_it == old_rules.end() || new_it->first < old_it->first) {
+      // added rule
+      changes.push_back(new_it->first);
+      ++new_it;
+    } else {
+      // any change to the setting is an update
+      if (old_it->second != new_it->second)
+        changes.push_back(new_it->first);
+      ++old_it;
+      ++new_it;
+    }
+  }
+  return changes;
+}
+
+void BravePrefProvider::NotifyChanges(
+    const std::vector<RulePatterns>& patterns,
+    bool incognito) {
+  for (const auto& pattern : patterns) {
+    Notify(pattern.first, pattern.second, ContentSettingsType::COOKIES);
   }
 }
 
@@ -9,13 +9,17 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/memory/weak_ptr.h"
 #include "base/synchronization/lock.h"
 #include "base/thread_annotations.h"
 #include "components/content_settings/core/browser/content_settings_observer.h"
 #include "components/content_settings/core/browser/content_settings_pref_provider.h"
+#include "components/content_settings/core/common/content_settings.h"
+#include "components/content_settings/core/common/content_settings_pattern.h"
 #include "components/prefs/pref_change_registrar.h"
 
 namespace content_settings {
@@ -47,6 +51,10 @@ class BravePrefProvider : public PrefProvider,
       bool incognito) const override;
 
  private:
+  using RulePatterns =
+      std::pair<ContentSettingsPattern, ContentSettingsPattern>;
+  using CookieRuleSettings = base::flat_map<RulePatterns, ContentSetting>;
+
   friend class BravePrefProviderTest;
   FRIEND_TEST_ALL_PREFIXES(BravePrefProviderTest, TestShieldsSettingsMigration);
   FRIEND_TEST_ALL_PREFIXES(BravePrefProviderTest,
@@ -55,6 +63,7 @@ class BravePrefProvider : public PrefProvider,
                            TestShieldsSettingsMigrationFromResourceIDs);
   FRIEND_TEST_ALL_PREFIXES(BravePrefProviderTest,
                            TestShieldsSettingsMigrationFromUnknownSettings);
+  FRIEND_TEST_ALL_PREFIXES(BravePrefProviderTest, TestCookieRuleChanges);
   void MigrateShieldsSettings(bool incognito);
   void MigrateShieldsSettingsFromResourceIds();
   void MigrateShieldsSettingsFromResourceIdsForOneType(
@@ -68,7 +77,13 @@ class BravePrefProvider : public PrefProvider,
   void MigrateShieldsSettingsV1ToV2ForOneType(ContentSettingsType content_type);
   void UpdateCookieRules(ContentSettingsType content_type, bool incognito);
   void OnCookieSettingsChanged(ContentSettingsType content_type);
-  void NotifyChanges(const std::vector<Rule>& rules, bool incognito);
+  // Returns the patterns of rules that were added to, removed from or changed
+  // between |old_rules| and |new_rules|.
+  static std::vector<RulePatterns> GetChangedCookieRulePatterns(
+      const CookieRuleSettings& old_rules,
+      const CookieRuleSettings& new_rules);
+  void NotifyChanges(const std::vector<RulePatterns>& patterns,
+                     bool incognito);
   bool SetWebsiteSettingInternal(
       const ContentSettingsPattern& primary_pattern,
       const ContentSettingsPattern& secondary_pattern,
@@ -85,7 +100,7 @@ class BravePrefProvider : public PrefProvider,
   mutable base::Lock lock_;
   std::map<bool /* is_incognito */, std::vector<Rule>> cookie_rules_
       GUARDED_BY(lock_);
-  std::map<bool /* is_incognito */, std::vector<Rule>> brave_cookie_rules_;
+  std::map<bool /* is_incognito */, CookieRuleSettings> brave_cookie_rules_;
 
   bool initialized_;
   bool store_last_modified_;
@@ -3,8 +3,10 @@
  * License, v. 2.0. If a copy of the MPL was not distributed with this file,
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
+#include <algorithm>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "base/memory/raw_ptr.h"
 #include "base/values.h"
@@ -525,4 +527,44 @@ TEST_F(BravePrefProviderTest, TestShieldsSettingsMigrationFromUnknownSettings) {
   provider.ShutdownOnUIThread();
 }
 
+TEST_F(BravePrefProviderTest, TestCookieRuleChanges) {
+  using RulePatterns = BravePrefProvider::RulePatterns;
+  const RulePatterns unchanged(
+      ContentSettingsPattern::Wildcard(),
+      ContentSettingsPattern::FromString("https://[*.]a.com/*"));
+  const RulePatterns changed(
+      ContentSettingsPattern::Wildcard(),
+      ContentSettingsPattern::FromString("https://[*.]b.com/*"));
+  const RulePatterns removed(
+      ContentSettingsPattern::FromString("https://[*.]c.com/*"),
+      ContentSettingsPattern::Wildcard());
+  const RulePatterns added(
+      ContentSettingsPattern::FromString("https://[*.]d.com/*"),
+      ContentSettingsPattern::Wildcard());
+
+  const BravePrefProvider::CookieRuleSettings old_rules(
+      {{unchanged, CONTENT_SETTING_ALLOW},
+       {changed, CONTENT_SETTING_ALLOW},
+       {removed, CONTENT_SETTING_BLOCK}});
+  const BravePrefProvider::CookieRuleSettings new_rules(
+      {{unchanged, CONTENT_SETTING_ALLOW},
+       {changed, CONTENT_SETTING_BLOCK},
+       {added, CONTENT_SETTING_ALLOW}});
+
+  auto changes =
+      BravePrefProvider::GetChangedCookieRulePatterns(old_rules, new_rules);
+  std::sort(changes.begin(), changes.end());
+  std::vector<RulePatterns> expected_changes = {changed, removed, added};
+  std::sort(expected_changes.begin(), expected_changes.end());
+  EXPECT_EQ(expected_changes, changes);
+
+  EXPECT_TRUE(
+      BravePrefProvider::GetChangedCookieRulePatterns(new_rules, new_rules)
+          .empty());
+  EXPECT_EQ(3u, BravePrefProvider::GetChangedCookieRulePatterns(
+                    {}, new_rules).size());
+  EXPECT_EQ(3u, BravePrefProvider::GetChangedCookieRulePatterns(
+                    old_rules, {}).size());
+}
+
 }  //  namespace content_settings
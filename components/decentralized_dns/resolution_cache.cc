@@ -0,0 +1,160 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/decentralized_dns/resolution_cache.h"
+
+#include <memory>
+#include <utility>
+
+#include "base/check.h"
+#include "content/public/browser/browser_context.h"
+
+namespace decentralized_dns {
+
+namespace {
+
+const void* const kResolutionCacheKey = &kResolutionCacheKey;
+
+// Records rarely change, so resolved hosts are cached for longer than hosts
+// without usable records, which may be configured at any time.
+constexpr base::TimeDelta kPositiveTTL = base::Minutes(5);
+constexpr base::TimeDelta kNegativeTTL = base::Minutes(1);
+
+// Expired entries are still used for this long while being refreshed in the
+// background, so that subresources are not held on eth_call round trips.
+constexpr base::TimeDelta kStaleWhileRevalidate = base::Hours(1);
+
+// A resolution which has not completed after this long is assumed to have
+// been dropped and is started again.
+constexpr base::TimeDelta kResolveTimeout = base::Seconds(30);
+
+constexpr size_t kMaxEntries = 256;
+
+}  // namespace
+
+ResolutionCache::PendingLookup::PendingLookup() = default;
+ResolutionCache::PendingLookup::PendingLookup(PendingLookup&&) = default;
+ResolutionCache::PendingLookup& ResolutionCache::PendingLookup::operator=(
+    PendingLookup&&) = default;
+ResolutionCache::PendingLookup::~PendingLookup() = default;
+
+ResolutionCache::ResolutionCache() = default;
+
+ResolutionCache::~ResolutionCache() = default;
+
+// static
+ResolutionCache* ResolutionCache::GetForBrowserContext(
+    content::BrowserContext* context) {
+  DCHECK(context);
+
+  auto* cache =
+      static_cast<ResolutionCache*>(context->GetUserData(kResolutionCacheKey));
+  if (!cache) {
+    auto new_cache = std::make_unique<ResolutionCache>();
+    cache = new_cache.get();
+    context->SetUserData(kResolutionCacheKey, std::move(new_cache));
+  }
+
+  return cache;
+}
+
+ResolutionCache::LookupResult ResolutionCache::Lookup(
+    const std::string& host,
+    std::string* url_spec,
+    LookupCallback callback) {
+  DCHECK(url_spec);
+
+  const base::TimeTicks now = base::TimeTicks::Now();
+
+  auto iter = entries_.find(host);
+  if (iter != entries_.end()) {
+    const Entry& entry = iter->second;
+    if (now < entry.expires_at) {
+      *url_spec = entry.url_spec;
+      return LookupResult::kHit;
+    }
+
+    if (now < entry.expires_at + kStaleWhileRevalidate) {
+      *url_spec = entry.url_spec;
+      if (IsResolving(host, now))
+        return LookupResult::kHit;
+
+      pending_lookups_[host].started_at = now;
+      return LookupResult::kStaleHit;
+    }
+
+    entries_.erase(iter);
+  }
+
+  const bool is_resolving = IsResolving(host, now);
+
+  PendingLookup& pending_lookup = pending_lookups_[host];
+  pending_lookup.callbacks.push_back(std::move(callback));
+  if (is_resolving)
+    return LookupResult::kPending;
+
+  pending_lookup.started_at = now;
+  return LookupResult::kMiss;
+}
+
+void ResolutionCache::OnResolved(const std::string& host,
+                                 bool success,
+                                 const std::string& url_spec) {
+  if (success) {
+    const base::TimeTicks now = base::TimeTicks::Now();
+    EvictIfNeeded(now);
+
+    Entry& entry = entries_[host];
+    entry.url_spec = url_spec;
+    entry.expires_at = now + (url_spec.empty() ? kNegativeTTL : kPositiveTTL);
+  }
+
+  auto iter = pending_lookups_.find(host);
+  if (iter == pending_lookups_.end())
+    return;
+
+  // Callbacks may look up hosts again, so detach them before running them.
+  std::vector<LookupCallback> callbacks = std::move(iter->second.callbacks);
+  pending_lookups_.erase(iter);
+
+  const std::string redirect_url_spec = success ? url_spec : std::string();
+  for (auto& callback : callbacks)
+    std::move(callback).Run(redirect_url_spec);
+}
+
+bool ResolutionCache::IsResolving(const std::string& host,
+                                  base::TimeTicks now) const {
+  const auto iter = pending_lookups_.find(host);
+  if (iter == pending_lookups_.end() || iter->second.started_at.is_null())
+    return false;
+
+  return now - iter->second.started_at < kResolveTimeout;
+}
+
+void ResolutionCache::EvictIfNeeded(base::TimeTicks now) {
+  if (entries_.size() < kMaxEntries)
+    return;
+
+  for (auto iter = entries_.begin(); iter != entries_.end();) {
+    if (now >= iter->second.expires_at + kStaleWhileRevalidate) {
+      iter = entries_.erase(iter);
+    } else {
+      ++iter;
+    }
+  }
+
+  if (entries_.size() < kMaxEntries)
+    return;
+
+  auto oldest_iter = entries_.begin();
+  for (auto iter = entries_.begin(); iter != entries_.end(); ++iter) {
+    if (iter->second.expires_at < oldest_iter->second.expires_at)
+      oldest_iter = iter;
+  }
+
+  entries_.erase(oldest_iter);
+}
+
+}  // namespace decentralized_dns
@@ -0,0 +1,95 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_DECENTRALIZED_DNS_RESOLUTION_CACHE_H_
+#define BRAVE_COMPONENTS_DECENTRALIZED_DNS_RESOLUTION_CACHE_H_
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "base/callback.h"
+#include "base/supports_user_data.h"
+#include "base/time/time.h"
+
+namespace content {
+class BrowserContext;
+}  // namespace content
+
+namespace decentralized_dns {
+
+// Per profile cache of decentralized DNS resolutions, mapping a host such as
+// brave.crypto or brave.eth to the URL spec it should be redirected to. An
+// empty URL spec means the host resolved without any usable records.
+class ResolutionCache : public base::SupportsUserData::Data {
+ public:
+  // Runs with the URL spec to redirect to, or an empty string if there is no
+  // redirect for the host.
+  using LookupCallback = base::OnceCallback<void(const std::string& url_spec)>;
+
+  enum class LookupResult {
+    // |url_spec| was set from an unexpired entry.
+    kHit,
+    // |url_spec| was set from an expired entry. The caller should resolve the
+    // host in the background and call |OnResolved|.
+    kStaleHit,
+    // The host is already being resolved and |callback| will run once it is.
+    kPending,
+    // The caller should resolve the host and call |OnResolved|, after which
+    // |callback| will run.
+    kMiss,
+  };
+
+  ResolutionCache();
+  ~ResolutionCache() override;
+
+  ResolutionCache(const ResolutionCache&) = delete;
+  ResolutionCache& operator=(const ResolutionCache&) = delete;
+
+  // Returns the cache for |context|, creating it if needed.
+  static ResolutionCache* GetForBrowserContext(
+      content::BrowserContext* context);
+
+  LookupResult Lookup(const std::string& host,
+                      std::string* url_spec,
+                      LookupCallback callback);
+
+  // Caches |url_spec| for |host| if |success| and runs any pending lookups.
+  // Failed resolutions are not cached so that they are retried.
+  void OnResolved(const std::string& host,
+                  bool success,
+                  const std::string& url_spec);
+
+  size_t size() const { return entries_.size(); }
+
+ private:
+  struct Entry {
+    std::string url_spec;
+    base::TimeTicks expires_at;
+  };
+
+  struct PendingLookup {
+    PendingLookup();
+    PendingLookup(PendingLookup&&);
+    PendingLookup& operator=(PendingLookup&&);
+    ~PendingLookup();
+
+    base::TimeTicks started_at;
+    std::vector<LookupCallback> callbacks;
+  };
+
+  // Returns true if a resolution was started for |host| and has not timed
+  // out, in which case the result will be delivered to pending lookups.
+  bool IsResolving(const std::string& host, base::TimeTicks now) const;
+
+  void EvictIfNeeded(base::TimeTicks now);
+
+  std::map<std::string, Entry> entries_;
+  std::map<std::string, PendingLookup> pending_lookups_;
+};
+
+}  // namespace decentralized_dns
+
+#endif  // BRAVE_COMPONENTS_DECENTRALIZED_DNS_RESOLUTION_CACHE_H_
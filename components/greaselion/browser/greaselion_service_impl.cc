@@ -6,7 +6,9 @@
 #include "brave/components/greaselion/browser/greaselion_service_impl.h"
 
 #include <stddef.h>
+#include <algorithm>
 #include <memory>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -16,10 +18,13 @@
 #include "base/callback_helpers.h"
 #include "base/command_line.h"
 #include "base/feature_list.h"
+#include "base/files/file_enumerator.h"
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
+#include "base/ignore_result.h"
 #include "base/json/json_file_value_serializer.h"
 #include "base/one_shot_event.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/task/post_task.h"
@@ -60,17 +65,190 @@ bool ShouldComputeHashesForResource(
   return !components.empty() && components[0] != extensions::kMetadataFolder;
 }
 
+constexpr char kCacheDirectoryName[] = "Cache";
+// Set once the cache has been swept, which happens once per browser session
+// since the cache directory is shared by all profiles.
+bool g_cache_swept = false;
+constexpr base::FilePath::CharType kCacheKeyExtension[] =
+    FILE_PATH_LITERAL("key");
+
+// Greaselion scripts are not signed, but the public key for an extension
+// doubles as its unique identity, and we need one of those, so we add the
+// rule name to a known Brave domain and hash the result to create a
+// public key.
+std::string GetPublicKeyForRule(const greaselion::GreaselionRule& rule) {
+  char raw[crypto::kSHA256Length] = {0};
+  std::string key;
+  const base::CommandLine& command_line =
+      *base::CommandLine::ForCurrentProcess();
+  if (!command_line.HasSwitch(brave_component_updater::kUseGoUpdateDev) &&
+      !base::FeatureList::IsEnabled(
+          brave_component_updater::kUseDevUpdaterUrl)) {
+    crypto::SHA256HashString(UPDATER_DEV_ENDPOINT + rule.name(),
+                             raw,
+                             crypto::kSHA256Length);
+  } else {
+    crypto::SHA256HashString(UPDATER_PROD_ENDPOINT + rule.name(),
+                             raw,
+                             crypto::kSHA256Length);
+  }
+  base::Base64Encode(base::StringPiece(raw, crypto::kSHA256Length), &key);
+  return key;
+}
+
+void AppendCacheKeyInput(const std::string& value, std::string* input) {
+  input->append(base::NumberToString(value.size()));
+  input->push_back(':');
+  input->append(value);
+}
+
+// Returns a digest of everything that ends up in the converted extension for
+// |rule|, or an empty string if one of its files can't be read.
+std::string ComputeCacheKey(const greaselion::GreaselionRule& rule,
+                            const std::string& public_key) {
+  std::string input;
+  AppendCacheKeyInput(version_info::GetVersionNumber(), &input);
+  AppendCacheKeyInput(
+      version_info::GetBraveVersionWithoutChromiumMajorVersion(), &input);
+  AppendCacheKeyInput(public_key, &input);
+  AppendCacheKeyInput(rule.name(), &input);
+  AppendCacheKeyInput(rule.run_at(), &input);
+  for (const auto& url_pattern : rule.url_patterns())
+    AppendCacheKeyInput(url_pattern, &input);
+
+  for (const auto& script : rule.scripts()) {
+    std::string contents;
+    if (!base::ReadFileToString(script, &contents))
+      return std::string();
+    AppendCacheKeyInput(script.BaseName().AsUTF8Unsafe(), &input);
+    AppendCacheKeyInput(contents, &input);
+  }
+
+  if (!rule.messages().empty()) {
+    std::vector<base::FilePath> message_files;
+    base::FileEnumerator enumerator(rule.messages(), true,
+                                    base::FileEnumerator::FILES);
+    for (base::FilePath path = enumerator.Next(); !path.empty();
+         path = enumerator.Next()) {
+      message_files.push_back(path);
+    }
+    std::sort(message_files.begin(), message_files.end());
+
+    for (const auto& path : message_files) {
+      base::FilePath relative_path;
+      std::string contents;
+      if (!rule.messages().AppendRelativePath(path, &relative_path) ||
+          !base::ReadFileToString(path, &contents)) {
+        return std::string();
+      }
+      AppendCacheKeyInput(relative_path.AsUTF8Unsafe(), &input);
+      AppendCacheKeyInput(contents, &input);
+    }
+  }
+
+  return base::HexEncode(crypto::SHA256HashString(input).data(),
+                         crypto::kSHA256Length);
+}
+
+// Each conversion lives in a directory named after its cache key, so a
+// directory is never modified once complete and can be shared by every
+// profile that loads it.
+base::FilePath GetCacheDirectory(const base::FilePath& install_dir,
+                                 const std::string& cache_key) {
+  return install_dir.AppendASCII(kCacheDirectoryName).AppendASCII(cache_key);
+}
+
+// Deletes everything under the cache directory that is not a complete
+// conversion of one of |rules|. Must run before any profile loads an
+// extension from the cache.
+void SweepCacheOnTaskRunner(
+    const std::vector<greaselion::GreaselionRule>& rules,
+    const base::FilePath& install_dir) {
+  std::set<base::FilePath> referenced_paths;
+  for (const auto& rule : rules) {
+    const std::string cache_key =
+        ComputeCacheKey(rule, GetPublicKeyForRule(rule));
+    if (cache_key.empty())
+      continue;
+    const base::FilePath cache_dir = GetCacheDirectory(install_dir, cache_key);
+    const base::FilePath marker = cache_dir.AddExtension(kCacheKeyExtension);
+    if (!base::PathExists(marker))
+      continue;
+    referenced_paths.insert(cache_dir);
+    referenced_paths.insert(marker);
+  }
+
+  base::FileEnumerator enumerator(
+      install_dir.AppendASCII(kCacheDirectoryName), false,
+      base::FileEnumerator::FILES | base::FileEnumerator::DIRECTORIES);
+  for (base::FilePath path = enumerator.Next(); !path.empty();
+       path = enumerator.Next()) {
+    if (!referenced_paths.count(path))
+      base::DeletePathRecursively(path);
+  }
+}
+
+// Loads the extension converted for a previous session if it was built from
+// the same inputs.
+scoped_refptr<Extension> LoadCachedExtension(const base::FilePath& cache_dir,
+                                             const std::string& cache_key) {
+  std::string cached_key;
+  if (!base::ReadFileToString(cache_dir.AddExtension(kCacheKeyExtension),
+                              &cached_key) ||
+      cached_key != cache_key) {
+    return nullptr;
+  }
+
+  std::string error;
+  scoped_refptr<Extension> extension = extensions::file_util::LoadExtension(
+      cache_dir, ManifestLocation::kComponent, Extension::NO_FLAGS, &error);
+  if (!extension)
+    VLOG(1) << "Could not load cached Greaselion extension: " << error;
+  return extension;
+}
+
+// Moves the converted extension in |temp_dir| to |cache_dir|. Existing cache
+// directories may be in use by other profiles, so this fails rather than
+// replacing one. On failure |temp_dir| keeps ownership of the converted
+// extension.
+bool MoveToCache(base::ScopedTempDir* temp_dir,
+                 const base::FilePath& cache_dir) {
+  if (base::PathExists(cache_dir) ||
+      !base::CreateDirectory(cache_dir.DirName())) {
+    return false;
+  }
+
+  const base::FilePath temp_path = temp_dir->Take();
+  if (base::Move(temp_path, cache_dir))
+    return true;
+
+  ignore_result(temp_dir->Set(temp_path));
+  return false;
+}
+
 // Wraps a Greaselion rule in a component. The component is stored as
 // an unpacked extension in the user data dir. Returns a valid
 // extension that the caller should take ownership of, or nullptr.
+// Conversions are cached across sessions under |install_dir|, in a directory
+// named after a digest of the rule's content and the browser version.
 //
 // NOTE: This function does file IO and should not be called on the UI thread.
 // NOTE: The caller takes ownership of the directory at extension->path() on the
-// returned object.
+// returned object unless it was loaded from or moved to the cache.
 absl::optional<greaselion::GreaselionServiceImpl::GreaselionConvertedExtension>
 ConvertGreaselionRuleToExtensionOnTaskRunner(
     const greaselion::GreaselionRule& rule,
     const base::FilePath& install_dir) {
+  const std::string key = GetPublicKeyForRule(rule);
+  const std::string cache_key = ComputeCacheKey(rule, key);
+  const base::FilePath cache_dir = GetCacheDirectory(install_dir, cache_key);
+  if (!cache_key.empty()) {
+    scoped_refptr<Extension> extension =
+        LoadCachedExtension(cache_dir, cache_key);
+    if (extension)
+      return std::make_pair(extension, base::ScopedTempDir());
+  }
+
   base::FilePath install_temp_dir =
       extensions::file_util::GetInstallTempDir(install_dir);
   if (install_temp_dir.empty()) {
@@ -91,29 +269,7 @@ ConvertGreaselionRuleToExtensionOnTaskRunner(
   // see kModernManifestVersion in src/extensions/common/extension.cc
   root->SetIntPath(extensions::manifest_keys::kManifestVersion, 2);
 
-  // Create the public key.
-  // Greaselion scripts are not signed, but the public key for an extension
-  // doubles as its unique identity, and we need one of those, so we add the
-  // rule name to a known Brave domain and hash the result to create a
-  // public key.
-  char raw[crypto::kSHA256Length] = {0};
-  std::string key;
   std::string script_name = rule.name();
-  const base::CommandLine& command_line =
-      *base::CommandLine::ForCurrentProcess();
-  if (!command_line.HasSwitch(brave_component_updater::kUseGoUpdateDev) &&
-      !base::FeatureList::IsEnabled(
-          brave_component_updater::kUseDevUpdaterUrl)) {
-    crypto::SHA256HashString(UPDATER_DEV_ENDPOINT + script_name,
-                             raw,
-                             crypto::kSHA256Length);
-  } else {
-    crypto::SHA256HashString(UPDATER_PROD_ENDPOINT + script_name,
-                             raw,
-                             crypto::kSHA256Length);
-  }
-  base::Base64Encode(base::StringPiece(raw, crypto::kSHA256Length), &key);
-
   root->SetStringPath(extensions::manifest_keys::kName, script_name);
   root->SetStringPath(extensions::manifest_keys::kVersion, "1.0");
   root->SetStringPath(extensions::manifest_keys::kDescription, "");
@@ -183,9 +339,13 @@ ConvertGreaselionRuleToExtensionOnTaskRunner(
     }
   }
 
+  base::FilePath extension_dir = temp_dir.GetPath();
+  if (!cache_key.empty() && MoveToCache(&temp_dir, cache_dir))
+    extension_dir = cache_dir;
+
   std::string error;
   scoped_refptr<Extension> extension = extensions::file_util::LoadExtension(
-      temp_dir.GetPath(), ManifestLocation::kComponent, Extension::NO_FLAGS,
+      extension_dir, ManifestLocation::kComponent, Extension::NO_FLAGS,
       &error);
   if (!extension.get()) {
     LOG(ERROR) << "Could not load Greaselion extension";
@@ -206,6 +366,11 @@ ConvertGreaselionRuleToExtensionOnTaskRunner(
             extensions::file_util::GetComputedHashesPath(extension->path()));
   }
 
+  // Written last so that only complete conversions are reused.
+  if (extension_dir == cache_dir) {
+    base::WriteFile(cache_dir.AddExtension(kCacheKeyExtension), cache_key);
+  }
+
   // Take ownership of this temporary directory so it's deleted when
   // the service exits
   return std::make_pair(extension, std::move(temp_dir));
@@ -300,6 +465,18 @@ void GreaselionServiceImpl::CreateAndInstallExtensions() {
     MaybeNotifyObservers();
     return;
   }
+  if (!g_cache_swept) {
+    // Stale conversions are only removed before the first conversion of the
+    // session, while no profile can be using them.
+    g_cache_swept = true;
+    std::vector<GreaselionRule> rule_copies;
+    for (const std::unique_ptr<GreaselionRule>& rule : *rules)
+      rule_copies.push_back(*rule);
+    task_runner_->PostTask(FROM_HERE,
+                           base::BindOnce(&SweepCacheOnTaskRunner,
+                                          std::move(rule_copies),
+                                          install_directory_));
+  }
   for (const std::unique_ptr<GreaselionRule>& rule : *rules) {
     if (rule->Matches(state_, browser_version_) &&
         rule->has_unknown_preconditions() == false) {
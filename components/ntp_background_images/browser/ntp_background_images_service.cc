@@ -470,6 +470,7 @@ void NTPBackgroundImagesService::OnGetComponentJsonData(
     const std::string& json_string) {
   bi_images_data_.reset(
       new NTPBackgroundImagesData(json_string, bi_installed_dir_));
+  image_cache_.Clear();
 
   for (auto& observer : observer_list_) {
     observer.OnUpdated(bi_images_data_.get());
@@ -516,6 +517,7 @@ void NTPBackgroundImagesService::OnGetSponsoredComponentJsonData(
     si_images_data_.reset(
         new NTPSponsoredImagesData(json_string, si_installed_dir_));
   }
+  image_cache_.Clear();
 
   if (is_super_referral && !sr_images_data_->IsValid()) {
     DVLOG(2) << __func__ << ": NTP SR campaign ends.";
@@ -17,6 +17,7 @@
 #include "base/observer_list.h"
 #include "base/timer/timer.h"
 #include "base/values.h"
+#include "brave/components/ntp_background_images/browser/ntp_image_cache.h"
 #include "components/prefs/pref_change_registrar.h"
 
 namespace component_updater {
@@ -64,6 +65,9 @@ class NTPBackgroundImagesService {
   NTPBackgroundImagesData* GetBackgroundImagesData() const;
   NTPSponsoredImagesData* GetBrandedImagesData(bool super_referral) const;
 
+  // Shared by the image sources of all profiles.
+  NTPImageCache* image_cache() { return &image_cache_; }
+
   bool test_data_used() const { return test_data_used_; }
 
   bool IsSuperReferral() const;
@@ -175,6 +179,7 @@ class NTPBackgroundImagesService {
   // not show SI images until user chooses Brave default images. So, we should
   // know the exact timing whether SR assets is ready to use or not.
   base::Value initial_sr_component_info_;
+  NTPImageCache image_cache_;
   base::WeakPtrFactory<NTPBackgroundImagesService> weak_factory_;
 };
 
@@ -0,0 +1,103 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/ntp_background_images/browser/ntp_image_cache.h"
+
+#include <utility>
+
+#include "base/bind.h"
+#include "base/files/file_util.h"
+#include "base/task/thread_pool.h"
+
+namespace ntp_background_images {
+
+namespace {
+
+// A background wallpaper, a sponsored wallpaper with its logo and the
+// prefetched next wallpaper, with some room for super referral top sites.
+constexpr size_t kMaxCachedImages = 6;
+
+absl::optional<std::string> ReadFileToString(const base::FilePath& path) {
+  std::string contents;
+  if (!base::ReadFileToString(path, &contents))
+    return absl::optional<std::string>();
+  return contents;
+}
+
+}  // namespace
+
+NTPImageCache::NTPImageCache() : images_(kMaxCachedImages) {}
+
+NTPImageCache::~NTPImageCache() = default;
+
+void NTPImageCache::GetImage(const base::FilePath& image_file_path,
+                             GetImageCallback callback) {
+  auto iter = images_.Get(image_file_path);
+  if (iter != images_.end()) {
+    std::move(callback).Run(iter->second);
+    return;
+  }
+
+  const bool is_reading = pending_reads_.count(image_file_path);
+  pending_reads_[image_file_path].push_back(std::move(callback));
+  if (!is_reading)
+    ReadImage(image_file_path);
+}
+
+void NTPImageCache::Prefetch(const base::FilePath& image_file_path) {
+  if (image_file_path.empty() ||
+      images_.Peek(image_file_path) != images_.end() ||
+      pending_reads_.count(image_file_path)) {
+    return;
+  }
+
+  pending_reads_[image_file_path];
+  ReadImage(image_file_path);
+}
+
+void NTPImageCache::Clear() {
+  images_.Clear();
+
+  // Reads in flight may have seen the files from before the update, so drop
+  // their replies and read again for anyone still waiting.
+  weak_factory_.InvalidateWeakPtrs();
+  for (auto iter = pending_reads_.begin(); iter != pending_reads_.end();) {
+    if (iter->second.empty()) {
+      iter = pending_reads_.erase(iter);
+    } else {
+      ReadImage(iter->first);
+      ++iter;
+    }
+  }
+}
+
+void NTPImageCache::ReadImage(const base::FilePath& image_file_path) {
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_VISIBLE},
+      base::BindOnce(&ReadFileToString, image_file_path),
+      base::BindOnce(&NTPImageCache::OnReadImage, weak_factory_.GetWeakPtr(),
+                     image_file_path));
+}
+
+void NTPImageCache::OnReadImage(const base::FilePath& image_file_path,
+                                absl::optional<std::string> contents) {
+  scoped_refptr<base::RefCountedMemory> bytes;
+  if (contents) {
+    bytes = base::RefCountedString::TakeString(&*contents);
+    images_.Put(image_file_path, bytes);
+  }
+
+  auto iter = pending_reads_.find(image_file_path);
+  if (iter == pending_reads_.end())
+    return;
+
+  std::vector<GetImageCallback> callbacks = std::move(iter->second);
+  pending_reads_.erase(iter);
+
+  for (auto& callback : callbacks)
+    std::move(callback).Run(bytes);
+}
+
+}  // namespace ntp_background_images
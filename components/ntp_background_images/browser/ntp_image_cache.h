@@ -0,0 +1,64 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_NTP_BACKGROUND_IMAGES_BROWSER_NTP_IMAGE_CACHE_H_
+#define BRAVE_COMPONENTS_NTP_BACKGROUND_IMAGES_BROWSER_NTP_IMAGE_CACHE_H_
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "base/callback.h"
+#include "base/containers/lru_cache.h"
+#include "base/files/file_path.h"
+#include "base/memory/ref_counted_memory.h"
+#include "base/memory/weak_ptr.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+namespace ntp_background_images {
+
+// Keeps the most recently served wallpaper and logo images in memory so that
+// opening a new tab page doesn't read the same image file from disk again.
+// Concurrent requests for an image that is being read share the same read.
+class NTPImageCache {
+ public:
+  using GetImageCallback =
+      base::OnceCallback<void(scoped_refptr<base::RefCountedMemory> bytes)>;
+
+  NTPImageCache();
+  ~NTPImageCache();
+
+  NTPImageCache(const NTPImageCache&) = delete;
+  NTPImageCache& operator=(const NTPImageCache&) = delete;
+
+  // Runs |callback| with the contents of |image_file_path|, which are read
+  // from disk if not cached. |bytes| is null if the file can't be read.
+  void GetImage(const base::FilePath& image_file_path,
+                GetImageCallback callback);
+
+  // Reads |image_file_path| into the cache ahead of it being requested.
+  void Prefetch(const base::FilePath& image_file_path);
+
+  // Called when images are updated as cached files are no longer served.
+  // Pending requests are answered from a fresh read of their file.
+  void Clear();
+
+  size_t size() const { return images_.size(); }
+
+ private:
+  void ReadImage(const base::FilePath& image_file_path);
+  void OnReadImage(const base::FilePath& image_file_path,
+                   absl::optional<std::string> contents);
+
+  base::LRUCache<base::FilePath, scoped_refptr<base::RefCountedMemory>>
+      images_;
+  std::map<base::FilePath, std::vector<GetImageCallback>> pending_reads_;
+
+  base::WeakPtrFactory<NTPImageCache> weak_factory_{this};
+};
+
+}  // namespace ntp_background_images
+
+#endif  // BRAVE_COMPONENTS_NTP_BACKGROUND_IMAGES_BROWSER_NTP_IMAGE_CACHE_H_
@@ -0,0 +1,105 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/ntp_background_images/browser/ntp_image_cache.h"
+
+#include <string>
+#include <vector>
+
+#include "base/bind.h"
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/test/task_environment.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace ntp_background_images {
+
+class NTPImageCacheTest : public testing::Test {
+ public:
+  NTPImageCacheTest() = default;
+
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    image_file_path_ = temp_dir_.GetPath().AppendASCII("wallpaper.jpg");
+    ASSERT_TRUE(base::WriteFile(image_file_path_, "image"));
+  }
+
+  void GetImage(const base::FilePath& image_file_path) {
+    cache_.GetImage(
+        image_file_path,
+        base::BindOnce(
+            [](std::vector<std::string>* results,
+               scoped_refptr<base::RefCountedMemory> bytes) {
+              results->push_back(
+                  bytes ? std::string(bytes->front_as<char>(), bytes->size())
+                        : "null");
+            },
+            &results_));
+  }
+
+  base::test::TaskEnvironment task_environment_;
+  base::ScopedTempDir temp_dir_;
+  base::FilePath image_file_path_;
+  NTPImageCache cache_;
+  std::vector<std::string> results_;
+};
+
+TEST_F(NTPImageCacheTest, ServeCachedImageWithoutReadingFile) {
+  GetImage(image_file_path_);
+  GetImage(image_file_path_);
+  EXPECT_TRUE(results_.empty());
+
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(std::vector<std::string>({"image", "image"}), results_);
+  EXPECT_EQ(1u, cache_.size());
+
+  ASSERT_TRUE(base::DeleteFile(image_file_path_));
+  GetImage(image_file_path_);
+  EXPECT_EQ(std::vector<std::string>({"image", "image", "image"}), results_);
+}
+
+TEST_F(NTPImageCacheTest, PrefetchImage) {
+  cache_.Prefetch(image_file_path_);
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(1u, cache_.size());
+
+  ASSERT_TRUE(base::DeleteFile(image_file_path_));
+  GetImage(image_file_path_);
+  EXPECT_EQ(std::vector<std::string>({"image"}), results_);
+}
+
+TEST_F(NTPImageCacheTest, DoNotCacheMissingImage) {
+  GetImage(temp_dir_.GetPath().AppendASCII("missing.jpg"));
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(std::vector<std::string>({"null"}), results_);
+  EXPECT_EQ(0u, cache_.size());
+}
+
+TEST_F(NTPImageCacheTest, ClearCache) {
+  cache_.Prefetch(image_file_path_);
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(1u, cache_.size());
+
+  cache_.Clear();
+  EXPECT_EQ(0u, cache_.size());
+}
+
+TEST_F(NTPImageCacheTest, ClearCacheWhileReading) {
+  GetImage(image_file_path_);
+  cache_.Prefetch(temp_dir_.GetPath().AppendASCII("logo.png"));
+  ASSERT_TRUE(base::WriteFile(image_file_path_, "updated image"));
+
+  cache_.Clear();
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(std::vector<std::string>({"updated image"}), results_);
+  EXPECT_EQ(1u, cache_.size());
+
+  ASSERT_TRUE(base::DeleteFile(image_file_path_));
+  GetImage(image_file_path_);
+  EXPECT_EQ(std::vector<std::string>({"updated image", "updated image"}),
+            results_);
+}
+
+}  // namespace ntp_background_images
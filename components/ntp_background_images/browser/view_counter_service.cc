@@ -22,6 +22,7 @@
 #include "brave/components/brave_rewards/common/pref_names.h"
 #include "brave/components/ntp_background_images/browser/features.h"
 #include "brave/components/ntp_background_images/browser/ntp_background_images_data.h"
+#include "brave/components/ntp_background_images/browser/ntp_image_cache.h"
 #include "brave/components/ntp_background_images/browser/ntp_sponsored_images_data.h"
 #include "brave/components/ntp_background_images/browser/url_constants.h"
 #include "brave/components/ntp_background_images/common/pref_names.h"
@@ -266,6 +267,48 @@ void ViewCounterService::RegisterPageView() {
   // This will be no-op when component is not ready.
   service_->CheckNTPSIComponentUpdateIfNeeded();
   model_.RegisterPageView();
+  PrefetchNextWallpaper();
+}
+
+void ViewCounterService::PrefetchNextWallpaper() {
+  // The model was advanced by RegisterPageView(), so the current wallpaper is
+  // the one the next new tab page will show.
+  NTPImageCache* image_cache = service_->image_cache();
+
+  if (ShouldShowBrandedWallpaper()) {
+    auto* data = GetCurrentBrandedWallpaperData();
+    size_t campaign_index;
+    size_t background_index;
+    std::tie(campaign_index, background_index) =
+        model_.GetCurrentBrandedImageIndex();
+    if (campaign_index >= data->campaigns.size() ||
+        background_index >=
+            data->campaigns[campaign_index].backgrounds.size()) {
+      return;
+    }
+
+    const auto& background =
+        data->campaigns[campaign_index].backgrounds[background_index];
+    image_cache->Prefetch(background.image_file);
+    image_cache->Prefetch(background.logo.image_file);
+    return;
+  }
+
+  if (!IsBackgroundWallpaperActive())
+    return;
+
+#if BUILDFLAG(ENABLE_CUSTOM_BACKGROUND)
+  // Custom backgrounds are replaced in place, so they are not cached.
+  if (custom_bi_service_ && custom_bi_service_->ShouldShowCustomBackground())
+    return;
+#endif
+
+  auto* data = GetCurrentWallpaperData();
+  const int index = model_.current_wallpaper_image_index();
+  if (index < 0 || static_cast<size_t>(index) >= data->backgrounds.size())
+    return;
+
+  image_cache->Prefetch(data->backgrounds[index].image_file);
 }
 
 void ViewCounterService::BrandedWallpaperLogoClicked(
@@ -142,6 +142,9 @@ class ViewCounterService : public KeyedService,
 
   void ResetModel();
 
+  // Reads the images for the next new tab page into the image cache.
+  void PrefetchNextWallpaper();
+
   void UpdateP3AValues() const;
 
   raw_ptr<NTPBackgroundImagesService> service_ = nullptr;
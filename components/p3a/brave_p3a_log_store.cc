@@ -51,6 +51,12 @@ void BraveP3ALogStore::RegisterPrefs(PrefRegistrySimple* registry) {
 
 void BraveP3ALogStore::UpdateValue(const std::string& histogram_name,
                                    uint64_t value) {
+  // Hot metrics are recorded over and over with the same value, which needs
+  // neither a new upload nor a pref write.
+  const auto iter = log_.find(histogram_name);
+  if (iter != log_.end() && iter->second.value == value)
+    return;
+
   LogEntry& entry = log_[histogram_name];
   entry.value = value;
   if (!entry.sent) {
@@ -47,7 +47,6 @@ namespace {
 // Receiving this value will effectively prevent the metric from transmission
 // to the backend. For now we consider this as a hack for p2a metrics, which
 // should be refactored in better times.
-constexpr int32_t kSuspendedMetricValue = INT_MAX - 1;
 constexpr uint64_t kSuspendedMetricBucket = INT_MAX - 1;
 
 constexpr char kLastRotationTimeStampPref[] = "p3a.last_rotation_timestamp";
@@ -60,6 +59,10 @@ constexpr char kP2AJsonServerUrl[] = "https://p2a-json.brave.com/";
 
 constexpr uint64_t kDefaultUploadIntervalSeconds = 60;  // 1 minute.
 
+// Histogram values recorded within this interval are handed to the UI thread
+// together, so that hot metrics don't post a task per sample.
+constexpr base::TimeDelta kFlushHistogramValuesDelay = base::Seconds(1);
+
 // TODO(iefremov): Provide moar histograms!
 // Whitelist for histograms that we collect. Will be replaced with something
 // updating on the fly.
@@ -444,15 +447,10 @@ void BraveP3AService::OnHistogramChanged(const char* histogram_name,
   if (samples->Iterator()->Done())
     return;
 
-  // Shortcut for the special values, see |kSuspendedMetricValue|
+  // Shortcut for the special values, see |kSuspendedMetricBucket|
   // description for details.
   if (IsSuspendedMetric(histogram_name, sample)) {
-    base::PostTask(FROM_HERE, {content::BrowserThread::UI},
-                   base::BindOnce(&BraveP3AService::OnHistogramChangedOnUI,
-                                  this,
-                                  histogram_name,
-                                  kSuspendedMetricValue,
-                                  kSuspendedMetricBucket));
+    AddPendingHistogramValue(histogram_name, kSuspendedMetricBucket);
     return;
   }
 
@@ -481,21 +479,44 @@ void BraveP3AService::OnHistogramChanged(const char* histogram_name,
     bucket = DirectEncodingProtocol::Perturb(bucket_count, bucket);
   }
 
-  base::PostTask(FROM_HERE, {content::BrowserThread::UI},
-                 base::BindOnce(&BraveP3AService::OnHistogramChangedOnUI, this,
-                                histogram_name, sample, bucket));
+  AddPendingHistogramValue(histogram_name, bucket);
 }
 
-void BraveP3AService::OnHistogramChangedOnUI(const char* histogram_name,
-                                             base::HistogramBase::Sample sample,
-                                             size_t bucket) {
-  VLOG(2) << "BraveP3AService::OnHistogramChanged: histogram_name = "
-          << histogram_name << " Sample = " << sample << " bucket = " << bucket;
-  if (!initialized_) {
-    // Will handle it later when ready.
-    histogram_values_[histogram_name] = bucket;
-  } else {
-    HandleHistogramChange(histogram_name, bucket);
+void BraveP3AService::AddPendingHistogramValue(const char* histogram_name,
+                                               size_t bucket) {
+  {
+    base::AutoLock lock(pending_histogram_values_lock_);
+    // Only the latest bucket of a metric is reported, so earlier values that
+    // haven't been flushed yet are simply overwritten.
+    pending_histogram_values_[histogram_name] = bucket;
+    if (is_flush_scheduled_)
+      return;
+    is_flush_scheduled_ = true;
+  }
+
+  base::PostDelayedTask(
+      FROM_HERE, {content::BrowserThread::UI},
+      base::BindOnce(&BraveP3AService::FlushPendingHistogramValuesOnUI, this),
+      kFlushHistogramValuesDelay);
+}
+
+void BraveP3AService::FlushPendingHistogramValuesOnUI() {
+  base::flat_map<base::StringPiece, size_t> histogram_values;
+  {
+    base::AutoLock lock(pending_histogram_values_lock_);
+    histogram_values.swap(pending_histogram_values_);
+    is_flush_scheduled_ = false;
+  }
+
+  for (const auto& entry : histogram_values) {
+    VLOG(2) << "BraveP3AService::OnHistogramChanged: histogram_name = "
+            << entry.first << " bucket = " << entry.second;
+    if (!initialized_) {
+      // Will handle it later when ready.
+      histogram_values_[entry.first] = entry.second;
+    } else {
+      HandleHistogramChange(entry.first, entry.second);
+    }
   }
 }
 
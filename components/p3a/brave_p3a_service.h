@@ -14,6 +14,8 @@
 #include "base/memory/ref_counted.h"
 #include "base/metrics/histogram_base.h"
 #include "base/metrics/statistics_recorder.h"
+#include "base/synchronization/lock.h"
+#include "base/thread_annotations.h"
 #include "base/timer/wall_clock_timer.h"
 #include "brave/components/p3a/brave_p3a_log_store.h"
 #include "brave/components/p3a/p3a_message.h"
@@ -82,9 +84,11 @@ class BraveP3AService : public base::RefCountedThreadSafe<BraveP3AService>,
                           uint64_t name_hash,
                           base::HistogramBase::Sample sample);
 
-  void OnHistogramChangedOnUI(const char* histogram_name,
-                              base::HistogramBase::Sample sample,
-                              size_t bucket);
+  // Records the latest |bucket| of a metric and schedules a flush to the UI
+  // thread if there isn't one pending already. Can be called on any thread.
+  void AddPendingHistogramValue(const char* histogram_name, size_t bucket);
+
+  void FlushPendingHistogramValuesOnUI();
 
   // Updates or removes a metric from the log.
   void HandleHistogramChange(base::StringPiece histogram_name, size_t bucket);
@@ -123,6 +127,13 @@ class BraveP3AService : public base::RefCountedThreadSafe<BraveP3AService>,
   // the service and its initialization.
   base::flat_map<base::StringPiece, size_t> histogram_values_;
 
+  // Histogram values recorded on any thread that are yet to be flushed to the
+  // UI thread.
+  base::Lock pending_histogram_values_lock_;
+  base::flat_map<base::StringPiece, size_t> pending_histogram_values_
+      GUARDED_BY(pending_histogram_values_lock_);
+  bool is_flush_scheduled_ GUARDED_BY(pending_histogram_values_lock_) = false;
+
   // Once fired we restart the overall uploading process.
   base::WallClockTimer rotation_timer_;
 
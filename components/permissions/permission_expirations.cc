@@ -9,6 +9,7 @@
 #include <memory>
 #include <utility>
 
+#include "base/containers/contains.h"
 #include "base/stl_util.h"
 #include "base/strings/strcat.h"
 #include "brave/components/permissions/permission_lifetime_pref_names.h"
@@ -35,6 +36,16 @@ constexpr base::StringPiece kRequestingOriginKey = "ro";
 constexpr base::StringPiece kEmbeddingOriginKey = "eo";
 constexpr base::StringPiece kContentSettingKey = "cs";
 
+std::vector<ContentSettingsType> GetContentTypes(
+    const PermissionExpirations::TypeKeyExpirationsMap& expirations) {
+  std::vector<ContentSettingsType> content_types;
+  content_types.reserve(expirations.size());
+  for (const auto& type_expirations : expirations) {
+    content_types.push_back(type_expirations.first);
+  }
+  return content_types;
+}
+
 }  // namespace
 
 // static
@@ -57,9 +68,13 @@ void PermissionExpirations::AddExpiringPermission(
     ContentSettingsType content_type,
     PermissionExpirationKey expiration_key,
     PermissionOrigins permission_origins) {
-  expirations_[content_type][expiration_key].push_back(
-      std::move(permission_origins));
-  UpdateExpirationsPref(content_type, {expiration_key});
+  auto& expiring_permissions = expirations_[content_type][expiration_key];
+  if (expiring_permissions.empty()) {
+    AddToExpirationTimes(content_type, expiration_key);
+  }
+  expiring_permissions.push_back(std::move(permission_origins));
+  AppendExpiringPermissionToPref(content_type, expiration_key,
+                                 expiring_permissions);
 }
 
 bool PermissionExpirations::RemoveExpiringPermissions(
@@ -98,6 +113,7 @@ bool PermissionExpirations::RemoveExpiringPermissions(
 
     // Remove empty nested containers.
     if (expiring_permissions.empty()) {
+      RemoveFromExpirationTimes(content_type, expiration_key);
       key_expirations_it = key_expirations_map.erase(key_expirations_it);
     } else {
       ++key_expirations_it;
@@ -115,92 +131,189 @@ bool PermissionExpirations::RemoveExpiringPermissions(
   }
 
   // Update prefs.
-  UpdateExpirationsPref(content_type, expiration_keys_to_update_prefs);
+  UpdateExpirationsPref(
+      {{content_type, std::move(expiration_keys_to_update_prefs)}});
   return true;
 }
 
 PermissionExpirations::ExpiredPermissions
 PermissionExpirations::RemoveExpiredPermissions(base::Time current_time) {
-  return RemoveExpiredPermissionsImpl(base::BindRepeating(
-      [](const PermissionExpirationKey& expiration_key,
-         const PermissionExpirations::KeyExpirationsMap& key_expirations) {
-        return std::make_pair(key_expirations.begin(),
-                              key_expirations.upper_bound(expiration_key));
-      },
-      PermissionExpirationKey(current_time)));
+  // Only visit content types which have expired permissions.
+  std::vector<ContentSettingsType> content_types;
+  for (auto it = expiration_times_.begin();
+       it != expiration_times_.end() && it->first <= current_time; ++it) {
+    if (!base::Contains(content_types, it->second)) {
+      content_types.push_back(it->second);
+    }
+  }
+  if (content_types.empty()) {
+    return {};
+  }
+
+  return RemoveExpiredPermissionsImpl(
+      content_types,
+      base::BindRepeating(
+          [](const PermissionExpirationKey& expiration_key,
+             const PermissionExpirations::KeyExpirationsMap& key_expirations) {
+            return std::make_pair(key_expirations.begin(),
+                                  key_expirations.upper_bound(expiration_key));
+          },
+          PermissionExpirationKey(current_time)));
 }
 
 PermissionExpirations::ExpiredPermissions
 PermissionExpirations::RemoveExpiredPermissions(const std::string& domain) {
-  return RemoveExpiredPermissionsImpl(base::BindRepeating(
-      [](const PermissionExpirationKey& expiration_key,
-         const PermissionExpirations::KeyExpirationsMap& key_expirations) {
-        return key_expirations.equal_range(expiration_key);
-      },
-      PermissionExpirationKey(domain)));
+  return RemoveExpiredPermissionsImpl(
+      GetContentTypes(expirations_),
+      base::BindRepeating(
+          [](const PermissionExpirationKey& expiration_key,
+             const PermissionExpirations::KeyExpirationsMap& key_expirations) {
+            return key_expirations.equal_range(expiration_key);
+          },
+          PermissionExpirationKey(domain)));
 }
 
 PermissionExpirations::ExpiredPermissions
 PermissionExpirations::RemoveAllDomainPermissions() {
-  return RemoveExpiredPermissionsImpl(base::BindRepeating(
-      [](const PermissionExpirationKey& expiration_key,
-         const PermissionExpirations::KeyExpirationsMap& key_expirations) {
-        return std::make_pair(key_expirations.upper_bound(expiration_key),
-                              key_expirations.end());
-      },
-      PermissionExpirationKey(base::Time::Max())));
+  return RemoveExpiredPermissionsImpl(
+      GetContentTypes(expirations_),
+      base::BindRepeating(
+          [](const PermissionExpirationKey& expiration_key,
+             const PermissionExpirations::KeyExpirationsMap& key_expirations) {
+            return std::make_pair(key_expirations.upper_bound(expiration_key),
+                                  key_expirations.end());
+          },
+          PermissionExpirationKey(base::Time::Max())));
 }
 
 PermissionExpirations::ExpiredPermissions
 PermissionExpirations::RemoveExpiredPermissionsImpl(
+    const std::vector<ContentSettingsType>& content_types,
     base::RepeatingCallback<std::pair<KeyExpirationsMap::const_iterator,
                                       KeyExpirationsMap::const_iterator>(
         const KeyExpirationsMap&)> predicate) {
   ExpiredPermissions expired_permissions;
+  ChangedExpirationKeys expiration_keys_to_clear_prefs;
 
-  // Enumerate all content types and remove all expired permissions.
-  for (auto expirations_it = expirations_.begin();
-       expirations_it != expirations_.end();) {
-    const auto content_type = expirations_it->first;
+  // Enumerate content types and remove all expired permissions.
+  for (const auto content_type : content_types) {
+    auto expirations_it = expirations_.find(content_type);
+    if (expirations_it == expirations_.end()) {
+      continue;
+    }
     auto& key_expirations_map = expirations_it->second;
 
-    std::vector<PermissionExpirationKey> expiration_keys_to_clear_prefs;
     auto iterator_pair = predicate.Run(key_expirations_map);
     auto key_expirations_begin_it =
         base::ConstCastIterator(key_expirations_map, iterator_pair.first);
     auto key_expirations_end_it =
         base::ConstCastIterator(key_expirations_map, iterator_pair.second);
+    if (key_expirations_begin_it == key_expirations_end_it) {
+      continue;
+    }
     for (auto key_expirations_it = key_expirations_begin_it;
          key_expirations_it != key_expirations_end_it; ++key_expirations_it) {
       const auto& expiration_key = key_expirations_it->first;
       auto& expiring_permissions = key_expirations_it->second;
       std::move(expiring_permissions.begin(), expiring_permissions.end(),
                 std::back_inserter(expired_permissions[content_type]));
-      expiration_keys_to_clear_prefs.push_back(expiration_key);
+      RemoveFromExpirationTimes(content_type, expiration_key);
+      expiration_keys_to_clear_prefs[content_type].push_back(expiration_key);
     }
     key_expirations_map.erase(key_expirations_begin_it, key_expirations_end_it);
 
     // Remove empty nested containers.
     if (key_expirations_map.empty()) {
-      expirations_it = expirations_.erase(expirations_it);
-    } else {
-      ++expirations_it;
+      expirations_.erase(expirations_it);
     }
-
-    // Update prefs.
-    UpdateExpirationsPref(content_type, expiration_keys_to_clear_prefs);
   }
+
+  // Update prefs.
+  UpdateExpirationsPref(expiration_keys_to_clear_prefs);
   return expired_permissions;
 }
 
+base::Time PermissionExpirations::GetNextExpirationTime() const {
+  if (expiration_times_.empty()) {
+    return base::Time::Max();
+  }
+  return expiration_times_.begin()->first;
+}
+
+void PermissionExpirations::AddToExpirationTimes(
+    ContentSettingsType content_type,
+    const PermissionExpirationKey& expiration_key) {
+  if (expiration_key.IsTimeKey()) {
+    expiration_times_.emplace(expiration_key.time(), content_type);
+  }
+}
+
+void PermissionExpirations::RemoveFromExpirationTimes(
+    ContentSettingsType content_type,
+    const PermissionExpirationKey& expiration_key) {
+  if (expiration_key.IsTimeKey()) {
+    expiration_times_.erase(
+        std::make_pair(expiration_key.time(), content_type));
+  }
+}
+
 void PermissionExpirations::UpdateExpirationsPref(
+    const ChangedExpirationKeys& changed_keys) {
+  if (!prefs_ || changed_keys.empty()) {
+    return;
+  }
+
+  // Use a scoped pref update to update only changed pref subkeys.
+  ScopedDictionaryPrefUpdate update(prefs_,
+                                    prefs::kPermissionLifetimeExpirations);
+  std::unique_ptr<DictionaryValueUpdate> key_expirations_val = update.Get();
+  DCHECK(key_expirations_val);
+
+  for (const auto& changed_type_keys : changed_keys) {
+    const ContentSettingsType content_type = changed_type_keys.first;
+    const std::string& content_type_name =
+        WebsiteSettingsRegistry::GetInstance()->Get(content_type)->name();
+
+    const auto& expirations_it = expirations_.find(content_type);
+    if (expirations_it == expirations_.end()) {
+      // Remove content type if it's absent in a runtime container.
+      key_expirations_val->RemovePath(content_type_name, nullptr);
+      continue;
+    }
+
+    const auto& key_expirations_map = expirations_it->second;
+    for (const auto& expiration_key : changed_type_keys.second) {
+      const auto& key_expirations_it = key_expirations_map.find(expiration_key);
+      const std::string& key = expiration_key.ToString();
+      if (key_expirations_it == key_expirations_map.end() ||
+          key_expirations_it->second.empty()) {
+        // Remove a key element if it's absent or empty in a runtime container.
+        std::unique_ptr<DictionaryValueUpdate> content_type_expirations_val;
+        if (key_expirations_val->GetDictionaryWithoutPathExpansion(
+                content_type_name, &content_type_expirations_val)) {
+          DCHECK(content_type_expirations_val);
+          content_type_expirations_val->RemoveWithoutPathExpansion(key,
+                                                                   nullptr);
+        }
+      } else {
+        // Update a key element if it's not empty in a runtime container.
+        key_expirations_val->SetPath(
+            {content_type_name, key},
+            ExpiringPermissionsToValue(key_expirations_it->second));
+      }
+    }
+  }
+}
+
+void PermissionExpirations::AppendExpiringPermissionToPref(
     ContentSettingsType content_type,
-    const std::vector<PermissionExpirationKey>& expiration_keys) {
+    const PermissionExpirationKey& expiration_key,
+    const ExpiringPermissions& expiring_permissions) {
+  DCHECK(!expiring_permissions.empty());
   if (!prefs_) {
     return;
   }
 
-  // Use a scoped pref update to update only changed pref subkeys.
   ScopedDictionaryPrefUpdate update(prefs_,
                                     prefs::kPermissionLifetimeExpirations);
   std::unique_ptr<DictionaryValueUpdate> key_expirations_val = update.Get();
@@ -208,34 +321,25 @@ void PermissionExpirations::UpdateExpirationsPref(
 
   const std::string& content_type_name =
       WebsiteSettingsRegistry::GetInstance()->Get(content_type)->name();
-
-  const auto& expirations_it = expirations_.find(content_type);
-  if (expirations_it == expirations_.end()) {
-    // Remove content type if it's absent in a runtime container.
-    key_expirations_val->RemovePath(content_type_name, nullptr);
+  const std::string& key = expiration_key.ToString();
+
+  // Append only the new permission if prefs hold all the previous ones.
+  std::unique_ptr<DictionaryValueUpdate> content_type_expirations_val;
+  base::ListValue* expiring_permissions_val = nullptr;
+  if (key_expirations_val->GetDictionaryWithoutPathExpansion(
+          content_type_name, &content_type_expirations_val) &&
+      content_type_expirations_val->GetListWithoutPathExpansion(
+          key, &expiring_permissions_val) &&
+      expiring_permissions_val->GetList().size() + 1 ==
+          expiring_permissions.size()) {
+    expiring_permissions_val->Append(
+        ExpiringPermissionToValue(expiring_permissions.back()));
     return;
   }
 
-  const auto& key_expirations_map = expirations_it->second;
-  for (const auto& expiration_key : expiration_keys) {
-    const auto& key_expirations_it = key_expirations_map.find(expiration_key);
-    const std::string& key = expiration_key.ToString();
-    if (key_expirations_it == key_expirations_map.end() ||
-        key_expirations_it->second.empty()) {
-      // Remove a key element if it's absent or empty in a runtime container.
-      std::unique_ptr<DictionaryValueUpdate> content_type_expirations_val;
-      if (key_expirations_val->GetDictionaryWithoutPathExpansion(
-              content_type_name, &content_type_expirations_val)) {
-        DCHECK(content_type_expirations_val);
-        content_type_expirations_val->RemoveWithoutPathExpansion(key, nullptr);
-      }
-    } else {
-      // Update a key element if it's not empty in a runtime container.
-      key_expirations_val->SetPath(
-          {content_type_name, key},
-          ExpiringPermissionsToValue(key_expirations_it->second));
-    }
-  }
+  key_expirations_val->SetPath(
+      {content_type_name, key},
+      ExpiringPermissionsToValue(expiring_permissions));
 }
 
 void PermissionExpirations::ReadExpirationsFromPrefs() {
@@ -275,6 +379,10 @@ void PermissionExpirations::ReadExpirationsFromPrefs() {
                                   std::move(expiring_permissions));
     }
     if (!key_expirations_map.empty()) {
+      for (const auto& key_expirations : key_expirations_map) {
+        AddToExpirationTimes(website_settings_info->type(),
+                             key_expirations.first);
+      }
       expirations_.emplace(website_settings_info->type(),
                            std::move(key_expirations_map));
     }
@@ -326,19 +434,24 @@ base::Value PermissionExpirations::ExpiringPermissionsToValue(
   items.reserve(expiring_permissions.size());
 
   for (const auto& expiring_permission : expiring_permissions) {
-    base::Value value(base::Value::Type::DICTIONARY);
-    value.SetStringKey(kRequestingOriginKey,
-                       expiring_permission.requesting_origin().spec());
-    if (expiring_permission.embedding_origin() !=
-        expiring_permission.requesting_origin()) {
-      value.SetStringKey(kEmbeddingOriginKey,
-                         expiring_permission.embedding_origin().spec());
-    }
-    value.SetIntKey(kContentSettingKey, expiring_permission.content_setting());
-    items.push_back(std::move(value));
+    items.push_back(ExpiringPermissionToValue(expiring_permission));
   }
 
   return base::Value(std::move(items));
 }
 
+base::Value PermissionExpirations::ExpiringPermissionToValue(
+    const PermissionOrigins& expiring_permission) const {
+  base::Value value(base::Value::Type::DICTIONARY);
+  value.SetStringKey(kRequestingOriginKey,
+                     expiring_permission.requesting_origin().spec());
+  if (expiring_permission.embedding_origin() !=
+      expiring_permission.requesting_origin()) {
+    value.SetStringKey(kEmbeddingOriginKey,
+                       expiring_permission.embedding_origin().spec());
+  }
+  value.SetIntKey(kContentSettingKey, expiring_permission.content_setting());
+  return value;
+}
+
 }  // namespace permissions
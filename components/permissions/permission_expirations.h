@@ -7,12 +7,14 @@
 #define BRAVE_COMPONENTS_PERMISSIONS_PERMISSION_EXPIRATIONS_H_
 
 #include <map>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "base/callback.h"
 #include "base/containers/flat_set.h"
+#include "base/time/time.h"
 #include "brave/components/permissions/permission_expiration_key.h"
 #include "brave/components/permissions/permission_origins.h"
 #include "components/content_settings/core/common/content_settings.h"
@@ -36,6 +38,8 @@ class PermissionExpirations {
       base::flat_map<ContentSettingsType, KeyExpirationsMap>;
   using ExpiredPermissions =
       base::flat_map<ContentSettingsType, ExpiringPermissions>;
+  using ChangedExpirationKeys =
+      base::flat_map<ContentSettingsType, std::vector<PermissionExpirationKey>>;
 
   static void RegisterProfilePrefs(user_prefs::PrefRegistrySyncable* registry);
 
@@ -59,30 +63,52 @@ class PermissionExpirations {
   // Remove expired permissions with a domain as a key.
   ExpiredPermissions RemoveAllDomainPermissions();
 
+  // Returns the nearest expiration time of all content types or
+  // base::Time::Max() if there are no time based expirations.
+  base::Time GetNextExpirationTime() const;
+
   const TypeKeyExpirationsMap& expirations() const { return expirations_; }
 
  private:
-  // Remove expired permissions using |predicate|.
+  // Remove expired permissions of |content_types| using |predicate|.
   ExpiredPermissions RemoveExpiredPermissionsImpl(
+      const std::vector<ContentSettingsType>& content_types,
       base::RepeatingCallback<std::pair<KeyExpirationsMap::const_iterator,
                                         KeyExpirationsMap::const_iterator>(
           const KeyExpirationsMap&)> predicate);
 
-  // Update value in prefs, |time_items| used to update only listed items.
-  void UpdateExpirationsPref(
+  // Keep |expiration_times_| in sync with the keys of |expirations_|.
+  void AddToExpirationTimes(ContentSettingsType content_type,
+                            const PermissionExpirationKey& expiration_key);
+  void RemoveFromExpirationTimes(ContentSettingsType content_type,
+                                 const PermissionExpirationKey& expiration_key);
+
+  // Update value in prefs, only listed keys of listed content types are
+  // updated. All changes are written in a single pref update.
+  void UpdateExpirationsPref(const ChangedExpirationKeys& changed_keys);
+  // Append the last of |expiring_permissions| to the |expiration_key| list in
+  // prefs instead of writing the whole list again.
+  void AppendExpiringPermissionToPref(
       ContentSettingsType content_type,
-      const std::vector<PermissionExpirationKey>& expiration_keys);
+      const PermissionExpirationKey& expiration_key,
+      const ExpiringPermissions& expiring_permissions);
 
   void ReadExpirationsFromPrefs();
   ExpiringPermissions ParseExpiringPermissions(
       const base::Value& expiring_permissions_val);
   base::Value ExpiringPermissionsToValue(
       const ExpiringPermissions& expiring_permissions) const;
+  base::Value ExpiringPermissionToValue(
+      const PermissionOrigins& expiring_permission) const;
 
   PrefService* const prefs_ = nullptr;
 
   // Expirations data from prefs used at runtime. Kept in sync with prefs.
   TypeKeyExpirationsMap expirations_;
+  // Time keys of all content types in |expirations_|, ordered by time, so
+  // that the nearest expiration is found and expired permissions are removed
+  // without visiting every content type.
+  std::set<std::pair<base::Time, ContentSettingsType>> expiration_times_;
 };
 
 }  // namespace permissions
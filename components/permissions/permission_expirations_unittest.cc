@@ -415,4 +415,71 @@ TEST_F(PermissionExpirationsTest, RemoveAllDomainExpirations) {
   CheckExpirationsPref(FROM_HERE, "{}");
 }
 
+TEST_F(PermissionExpirationsTest, NextExpirationTime) {
+  EXPECT_EQ(base::Time::Max(), expirations()->GetNextExpirationTime());
+
+  AddExpiringPermission(ContentSettingsType::NOTIFICATIONS, kOrigin);
+  EXPECT_EQ(base::Time::Max(), expirations()->GetNextExpirationTime());
+
+  AddExpiringPermission(ContentSettingsType::NOTIFICATIONS, base::Seconds(10),
+                        kOrigin);
+  AddExpiringPermission(ContentSettingsType::GEOLOCATION, base::Seconds(5),
+                        kOrigin2);
+  EXPECT_EQ(now_ + base::Seconds(5), expirations()->GetNextExpirationTime());
+
+  EXPECT_TRUE(expirations()->RemoveExpiringPermissions(
+      ContentSettingsType::GEOLOCATION,
+      base::BindLambdaForTesting(
+          [&](const PermissionOrigins& origins) { return true; })));
+  EXPECT_EQ(now_ + base::Seconds(10), expirations()->GetNextExpirationTime());
+
+  // Expirations are restored from prefs.
+  ResetExpirations();
+  EXPECT_EQ(now_ + base::Seconds(10), expirations()->GetNextExpirationTime());
+
+  expirations()->RemoveExpiredPermissions(now_ + base::Seconds(10));
+  EXPECT_EQ(base::Time::Max(), expirations()->GetNextExpirationTime());
+}
+
+TEST_F(PermissionExpirationsTest, ManyExpirations) {
+  constexpr int kCount = 20000;
+  for (int i = 0; i < kCount; ++i) {
+    const GURL origin("https://" + std::to_string(i) + ".example.com");
+    AddExpiringPermission(ContentSettingsType::NOTIFICATIONS,
+                          base::Milliseconds(i), origin);
+    expirations()->AddExpiringPermission(
+        ContentSettingsType::GEOLOCATION, PermissionExpirationKey("brave.com"),
+        MakePermissionOrigins(origin));
+  }
+  const base::Value* domain_expirations_val =
+      prefs()
+          ->GetDictionary(prefs::kPermissionLifetimeExpirations)
+          ->FindDictKey("geolocation");
+  ASSERT_TRUE(domain_expirations_val);
+  const base::Value* expiring_permissions_val =
+      domain_expirations_val->FindListKey("brave.com");
+  ASSERT_TRUE(expiring_permissions_val);
+  EXPECT_EQ(static_cast<size_t>(kCount),
+            expiring_permissions_val->GetList().size());
+
+  auto removed = expirations()->RemoveExpiredPermissions(
+      now_ + base::Milliseconds(kCount / 2 - 1));
+  ASSERT_EQ(1u, removed.size());
+  EXPECT_EQ(static_cast<size_t>(kCount / 2),
+            removed[ContentSettingsType::NOTIFICATIONS].size());
+  EXPECT_EQ(now_ + base::Milliseconds(kCount / 2),
+            expirations()->GetNextExpirationTime());
+
+  removed = expirations()->RemoveExpiredPermissions("brave.com");
+  ASSERT_EQ(1u, removed.size());
+  EXPECT_EQ(static_cast<size_t>(kCount),
+            removed[ContentSettingsType::GEOLOCATION].size());
+
+  removed = expirations()->RemoveExpiredPermissions(
+      now_ + base::Milliseconds(kCount));
+  EXPECT_EQ(static_cast<size_t>(kCount / 2),
+            removed[ContentSettingsType::NOTIFICATIONS].size());
+  CheckExpirationsPref(FROM_HERE, "{}");
+}
+
 }  // namespace permissions
@@ -192,17 +192,8 @@ void PermissionLifetimeManager::RestartExpirationTimerForTesting() {
 }
 
 void PermissionLifetimeManager::UpdateExpirationTimer() {
-  base::Time nearest_expiration_time(base::Time::Max());
-  for (const auto& type_expirations : permission_expirations_.expirations()) {
-    const auto& key_expirations_map = type_expirations.second;
-    if (key_expirations_map.empty() ||
-        !key_expirations_map.begin()->first.IsTimeKey()) {
-      continue;
-    }
-    nearest_expiration_time = std::min(
-        nearest_expiration_time, key_expirations_map.begin()->first.time());
-  }
-
+  const base::Time nearest_expiration_time =
+      permission_expirations_.GetNextExpirationTime();
   if (nearest_expiration_time == base::Time::Max()) {
     // Nothing to wait for. Stop the timer and return.
     StopExpirationTimer();
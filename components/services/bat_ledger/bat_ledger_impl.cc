@@ -132,20 +132,23 @@ void BatLedgerImpl::OnUnload(uint32_t tab_id, uint64_t current_time) {
   ledger_->OnUnload(tab_id, current_time);
 }
 
-void BatLedgerImpl::OnShow(uint32_t tab_id, uint64_t current_time) {
-  ledger_->OnShow(tab_id, current_time);
-}
-
-void BatLedgerImpl::OnHide(uint32_t tab_id, uint64_t current_time) {
-  ledger_->OnHide(tab_id, current_time);
-}
-
-void BatLedgerImpl::OnForeground(uint32_t tab_id, uint64_t current_time) {
-  ledger_->OnForeground(tab_id, current_time);
-}
-
-void BatLedgerImpl::OnBackground(uint32_t tab_id, uint64_t current_time) {
-  ledger_->OnBackground(tab_id, current_time);
+void BatLedgerImpl::OnTabEvents(std::vector<mojom::TabEventPtr> tab_events) {
+  for (const auto& tab_event : tab_events) {
+    switch (tab_event->type) {
+      case mojom::TabEventType::SHOW:
+        ledger_->OnShow(tab_event->tab_id, tab_event->current_time);
+        break;
+      case mojom::TabEventType::HIDE:
+        ledger_->OnHide(tab_event->tab_id, tab_event->current_time);
+        break;
+      case mojom::TabEventType::FOREGROUND:
+        ledger_->OnForeground(tab_event->tab_id, tab_event->current_time);
+        break;
+      case mojom::TabEventType::BACKGROUND:
+        ledger_->OnBackground(tab_event->tab_id, tab_event->current_time);
+        break;
+    }
+  }
 }
 
 void BatLedgerImpl::OnPostData(const std::string& url,
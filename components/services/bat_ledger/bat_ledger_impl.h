@@ -59,10 +59,7 @@ class BatLedgerImpl :
       visit_data,
       uint64_t current_time) override;
   void OnUnload(uint32_t tab_id, uint64_t current_time) override;
-  void OnShow(uint32_t tab_id, uint64_t current_time) override;
-  void OnHide(uint32_t tab_id, uint64_t current_time) override;
-  void OnForeground(uint32_t tab_id, uint64_t current_time) override;
-  void OnBackground(uint32_t tab_id, uint64_t current_time) override;
+  void OnTabEvents(std::vector<mojom::TabEventPtr> tab_events) override;
 
   void OnPostData(
       const std::string& url,